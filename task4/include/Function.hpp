@@ -2,6 +2,7 @@
 #define FUNCTION_HPP
 
 #include <cmath>
+#include <cstddef>
 
 // Abstract base class for a mathematical function.
 class Function {
@@ -9,12 +10,33 @@ public:
     virtual ~Function() = default;
     // Evaluate the function at x.
     virtual double operator()(double x) const = 0;
+
+    // Evaluate the function at n abscissae: y[i] = f(x[i]).
+    // The default falls back to one operator() call per point; derived
+    // classes override it with a loop the compiler can inline and vectorize.
+    virtual void evaluate(const double* x, double* y, std::size_t n) const {
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = (*this)(x[i]);
+        }
+    }
 };
 
 // Derived class for f(x) = cos(x) * exp(x)
-class CosExpFunction : public Function {
+// Declared final so that calls through a CosExpFunction& are devirtualized.
+class CosExpFunction final : public Function {
 public:
     double operator()(double x) const override {
+        return value(x);
+    }
+
+    void evaluate(const double* x, double* y, std::size_t n) const override {
+        for (std::size_t i = 0; i < n; ++i) {
+            y[i] = value(x[i]);
+        }
+    }
+
+private:
+    static double value(double x) {
         return std::cos(x) * std::exp(x);
     }
 };
@@ -14,16 +14,21 @@ struct InputParameters {
     int N;
     double x_inf;
     double x_sup;
+    std::string output_format;  // sample dump format: "text", "binary" or "hdf5"
 };
 
 // Read input parameters either from command-line arguments or a YAML file.
 inline InputParameters readInputs(int argc, char* argv[]) {
     InputParameters params;
-    if (argc == 4) {
+    params.output_format = "text";
+    if (argc == 4 || argc == 5) {
         try {
             params.N     = std::stoi(argv[1]);
             params.x_inf = std::stod(argv[2]);
             params.x_sup = std::stod(argv[3]);
+            if (argc == 5) {
+                params.output_format = argv[4];
+            }
         } catch (const std::exception& e) {
             throw std::runtime_error("Invalid command-line arguments.");
         }
@@ -39,13 +44,16 @@ inline InputParameters readInputs(int argc, char* argv[]) {
             params.N     = config["N"].as<int>();
             params.x_inf = config["x_inf"].as<double>();
             params.x_sup = config["x_sup"].as<double>();
+            if (config["output_format"]) {
+                params.output_format = config["output_format"].as<std::string>();
+            }
         } catch (const std::exception& e) {
             throw std::runtime_error("Invalid configuration file format.");
         }
     } else {
         throw std::runtime_error(
             "Usage:\n"
-            "  <program> <N> <x_inf> <x_sup>\n"
+            "  <program> <N> <x_inf> <x_sup> [text|binary|hdf5]\n"
             "or\n"
             "  <program> <config.yml>"
         );
@@ -3,12 +3,61 @@
 
 #include "Function.hpp"
 #include <stdexcept>
+#include <vector>
+#include <cmath>
+#include <queue>
+#include <algorithm>
+#include <cstddef>
 
-// Class for numerical integration.
-class Integrator {
+// Result of an incremental Romberg integration.
+struct RombergResult {
+    double value;           // last diagonal entry of the Romberg table
+    double error;           // |R[i][i] - R[i-1][i-1]| at the last level (0 after one level)
+    int levels;             // rows of the table that were computed
+    long long evaluations;  // number of function evaluations
+};
+
+// Result of an adaptive Gauss-Kronrod integration.
+struct AdaptiveResult {
+    double value;           // sum of the K15 estimates over all subintervals
+    double error;           // sum of the |K15 - G7| estimates over all subintervals
+    int intervals;          // number of subintervals at the end
+    long long evaluations;  // number of function evaluations
+};
+
+// Summation used inside each block of the parallel rules.
+enum class BlockSum {
+    Plain,        // one running double per block
+    Compensated   // Neumaier-compensated sum per block
+};
+
+namespace detail {
+// y[i] = f(x[i]) for i < n: uses F::evaluate when the integrand has one
+// (Function and its subclasses), otherwise calls f point by point.
+template <typename F>
+auto evaluateBatch(const F& f, const double* x, double* y, std::size_t n, int)
+    -> decltype(f.evaluate(x, y, n), void()) {
+    f.evaluate(x, y, n);
+}
+
+template <typename F>
+void evaluateBatch(const F& f, const double* x, double* y, std::size_t n, long) {
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = f(x[i]);
+    }
+}
+}  // namespace detail
+
+// Class for numerical integration of an integrand of type F.
+// F is any callable double(double) const: with F = Function every sample
+// goes through the virtual interface (runtime plug-ins), while a concrete
+// final class or a lambda is inlined and can be vectorized by the compiler.
+// The integrator keeps a reference, so the integrand must outlive it.
+template <typename F>
+class BasicIntegrator {
 public:
     // Construct with a reference to a function to integrate.
-    explicit Integrator(const Function& func) : function(func) {}
+    explicit BasicIntegrator(const F& func) : function(func) {}
 
     // Trapezoidal rule integration.
     double integrateTrapz(double a, double b, int n) const {
@@ -17,10 +66,11 @@ public:
         }
         double h = (b - a) / (n - 1);
         double sum = 0.5 * (function(a) + function(b));
-        for (int i = 1; i < n - 1; ++i) {
-            double xi = a + i * h;
-            sum += function(xi);
-        }
+        forEachBatch(a, h, 1, n - 1, [&](int /*first*/, const double* y, int count) {
+            for (int k = 0; k < count; ++k) {
+                sum += y[k];
+            }
+        });
         return sum * h;
     }
 
@@ -37,49 +87,337 @@ public:
         }
         double h = (b - a) / (n - 1);
         double sum = function(a) + function(b);
-        for (int i = 1; i < n - 1; ++i) {
-            double xi = a + i * h;
-            if (i % 2 == 0) {
-                sum += 2 * function(xi);
-            } else {
-                sum += 4 * function(xi);
+        forEachBatch(a, h, 1, n - 1, [&](int first, const double* y, int count) {
+            for (int k = 0; k < count; ++k) {
+                if ((first + k) % 2 == 0) {
+                    sum += 2 * y[k];
+                } else {
+                    sum += 4 * y[k];
+                }
             }
-        }
+        });
         return (h / 3.0) * sum;
     }
 
+    // Multithreaded trapezoidal rule.
+    // The interior samples are split into fixed blocks of kParallelBlock
+    // points that are summed in parallel (OpenMP); the block sums are then
+    // combined pairwise in a fixed tree, so the result is the same for any
+    // number of threads.
+    double integrateTrapzParallel(double a, double b, int n, BlockSum mode = BlockSum::Plain) const {
+        if(n < 2) {
+            throw std::invalid_argument("Number of sampling points must be at least 2.");
+        }
+        double h = (b - a) / (n - 1);
+        double interior = blockedSum(a, h, 1, n - 1, [](int) { return 1.0; }, mode);
+        return (0.5 * (function(a) + function(b)) + interior) * h;
+    }
+
+    // Multithreaded Simpson's rule (same blocking and reduction as above).
+    double integrateSimpsonParallel(double a, double b, int n, BlockSum mode = BlockSum::Plain) const {
+        if(n < 3) {
+            throw std::invalid_argument("Number of sampling points must be at least 3.");
+        }
+        if ((n - 1) % 2 != 0) {
+            ++n;
+        }
+        double h = (b - a) / (n - 1);
+        double interior = blockedSum(a, h, 1, n - 1, [](int i) { return (i % 2 == 0) ? 2.0 : 4.0; }, mode);
+        return (h / 3.0) * (function(a) + function(b) + interior);
+    }
+
     // Romberg integration.
     // Uses the trapezoidal rule with n = 2^i + 1 sampling points.
     // maxIter sets the maximum number of Romberg iterations.
     // tol specifies the convergence tolerance.
     double integrateRomberg(double a, double b, int maxIter = 5, double tol = 1e-12) const {
-        // Allocate a Romberg table R with dimensions maxIter x maxIter.
-        std::vector<std::vector<double>> R(maxIter, std::vector<double>(maxIter, 0.0));
+        return integrateRombergIncremental(a, b, maxIter, tol).value;
+    }
+
+    // Incremental Romberg integration.
+    // Level i refines the trapezoid estimate of level i-1 with the 2^(i-1)
+    // new midpoints only, T_i = T_(i-1)/2 + h_i * sum f(midpoints), so every
+    // abscissa is evaluated once.  Only the previous and the current row of
+    // the Romberg table are kept.
+    // If grid holds gridPoints precomputed samples of f at
+    // a + j*(b-a)/(gridPoints-1), every level whose points lie on that grid
+    // reads them from it; only deeper levels evaluate the function.
+    // evaluations counts function calls made here, not grid reads.
+    RombergResult integrateRombergIncremental(double a, double b, int maxIter = 5, double tol = 1e-12,
+                                              const double* grid = nullptr, int gridPoints = 0) const {
+        if (maxIter < 1) {
+            throw std::invalid_argument("Number of Romberg iterations must be at least 1.");
+        }
+        if (grid != nullptr && gridPoints < 2) {
+            throw std::invalid_argument("A sample grid needs at least 2 points.");
+        }
+        const int gridSegments = (grid != nullptr) ? gridPoints - 1 : 0;
+        std::vector<double> prev(maxIter, 0.0);
+        std::vector<double> curr(maxIter, 0.0);
 
         // Initial trapezoidal rule: use 2^0 segments => n = 2 points.
-        int n = 2;
-        R[0][0] = integrateTrapz(a, b, n);
+        RombergResult result;
+        result.evaluations = 0;
+        if (grid != nullptr) {
+            prev[0] = 0.5 * (b - a) * (grid[0] + grid[gridSegments]);
+        } else {
+            prev[0] = 0.5 * (b - a) * (function(a) + function(b));
+            result.evaluations = 2;
+        }
+        result.value = prev[0];
+        result.error = 0.0;
+        result.levels = 1;
 
-        // Build the Romberg table.
         for (int i = 1; i < maxIter; ++i) {
-            // Use 2^i segments, which means n = 2^i + 1 sampling points.
-            n = (1 << i) + 1;  // 1<<i computes 2^i.
-            R[i][0] = integrateTrapz(a, b, n);
+            // 2^i segments: the new points are the 2^(i-1) odd multiples of h.
+            const int newPoints = 1 << (i - 1);
+            const double h = (b - a) / (2.0 * newPoints);
+            double sum = 0.0;
+            if (gridSegments > 0 && gridSegments % (2 * newPoints) == 0) {
+                // midpoint k sits at grid index (2k+1) * stride
+                const int stride = gridSegments / (2 * newPoints);
+                for (int k = 0; k < newPoints; ++k) {
+                    sum += grid[(2 * k + 1) * stride];
+                }
+            } else {
+                forEachBatch(a + h, 2.0 * h, 0, newPoints, [&](int /*first*/, const double* y, int count) {
+                    for (int k = 0; k < count; ++k) {
+                        sum += y[k];
+                    }
+                });
+                result.evaluations += newPoints;
+            }
+            curr[0] = 0.5 * prev[0] + h * sum;
+
             // Apply Richardson extrapolation.
+            double factor = 1.0;
             for (int j = 1; j <= i; ++j) {
-                double factor = std::pow(4.0, j);
-                R[i][j] = R[i][j-1] + (R[i][j-1] - R[i-1][j-1]) / (factor - 1.0);
+                factor *= 4.0;
+                curr[j] = curr[j-1] + (curr[j-1] - prev[j-1]) / (factor - 1.0);
             }
+            result.value = curr[i];
+            result.error = std::fabs(curr[i] - prev[i-1]);
+            result.levels = i + 1;
             // Check for convergence between the last diagonal elements.
-            if (std::fabs(R[i][i] - R[i-1][i-1]) < tol) {
-                return R[i][i];
+            if (result.error < tol) {
+                break;
+            }
+            prev.swap(curr);
+        }
+        return result;
+    }
+
+    // Adaptive Gauss-Kronrod (G7/K15) integration.
+    // Subintervals are kept in a priority queue ordered by their error
+    // estimate |K15 - G7|.  Each step removes up to `splits` subintervals
+    // with the largest errors, bisects them and evaluates the 2*splits
+    // halves in parallel (OpenMP).  Children are pushed back in a fixed
+    // order, so the result does not depend on the number of threads.
+    // Stops when the total error estimate is below tol or the number of
+    // subintervals reaches maxIntervals.
+    AdaptiveResult integrateGaussKronrod(double a, double b, double tol = 1e-12,
+                                         int maxIntervals = 1000, int splits = 16) const {
+        if (maxIntervals < 1 || splits < 1) {
+            throw std::invalid_argument("maxIntervals and splits must be at least 1.");
+        }
+        std::priority_queue<Segment, std::vector<Segment>, LargerError> queue;
+        Segment whole = kronrod15(a, b);
+        queue.push(whole);
+        double totalError = whole.error;
+        long long evaluations = 15;
+
+        std::vector<Segment> parents;
+        std::vector<Segment> children;
+        while (totalError > tol && static_cast<int>(queue.size()) < maxIntervals) {
+            // Never grow past maxIntervals: each split adds one subinterval.
+            const int room = maxIntervals - static_cast<int>(queue.size());
+            const int take = std::min(std::min(splits, room), static_cast<int>(queue.size()));
+            parents.clear();
+            for (int k = 0; k < take; ++k) {
+                parents.push_back(queue.top());
+                queue.pop();
             }
+            children.resize(2 * parents.size());
+            const long long count = static_cast<long long>(children.size());
+            #pragma omp parallel for schedule(static)
+            for (long long c = 0; c < count; ++c) {
+                const Segment& p = parents[c / 2];
+                const double mid = 0.5 * (p.a + p.b);
+                children[c] = (c % 2 == 0) ? kronrod15(p.a, mid) : kronrod15(mid, p.b);
+            }
+            for (const Segment& p : parents) {
+                totalError -= p.error;
+            }
+            for (const Segment& c : children) {
+                totalError += c.error;
+                queue.push(c);
+            }
+            evaluations += 15 * count;
+        }
+
+        // Sum the final subintervals (the running totals above only steer the loop).
+        AdaptiveResult result;
+        result.value = 0.0;
+        result.error = 0.0;
+        result.intervals = static_cast<int>(queue.size());
+        result.evaluations = evaluations;
+        while (!queue.empty()) {
+            result.value += queue.top().value;
+            result.error += queue.top().error;
+            queue.pop();
         }
-        return R[maxIter-1][maxIter-1];
+        return result;
     }
 
 private:
-    const Function& function;
+    // One subinterval of the adaptive integration.
+    struct Segment {
+        double a;
+        double b;
+        double value;  // K15 estimate
+        double error;  // |K15 - G7|
+    };
+
+    // Orders the priority queue so the largest error is on top.
+    struct LargerError {
+        bool operator()(const Segment& l, const Segment& r) const {
+            return l.error < r.error;
+        }
+    };
+
+    // 15-point Kronrod rule with the embedded 7-point Gauss rule on [a, b]
+    // (nodes and weights as in QUADPACK's qk15).
+    Segment kronrod15(double a, double b) const {
+        static const double xgk[8] = {
+            0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+            0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+            0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+            0.207784955007898467600689403773245, 0.000000000000000000000000000000000
+        };
+        static const double wgk[8] = {
+            0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+            0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+            0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+            0.204432940075298892414161999234649, 0.209482141084727828012999174891714
+        };
+        // Gauss weights of the nodes xgk[1], xgk[3], xgk[5], xgk[7].
+        static const double wg[4] = {
+            0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+            0.381830050505118944950369775488975, 0.417959183673469387755102040816327
+        };
+
+        const double center = 0.5 * (a + b);
+        const double half = 0.5 * (b - a);
+        double x[15];
+        double y[15];
+        for (int j = 0; j < 7; ++j) {
+            x[2 * j] = center - half * xgk[j];
+            x[2 * j + 1] = center + half * xgk[j];
+        }
+        x[14] = center;
+        detail::evaluateBatch(function, x, y, 15, 0);
+
+        double kronrod = wgk[7] * y[14];
+        double gauss = wg[3] * y[14];
+        for (int j = 0; j < 7; ++j) {
+            const double pair = y[2 * j] + y[2 * j + 1];
+            kronrod += wgk[j] * pair;
+            if (j % 2 == 1) {
+                gauss += wg[j / 2] * pair;
+            }
+        }
+        Segment s;
+        s.a = a;
+        s.b = b;
+        s.value = kronrod * half;
+        s.error = std::fabs((kronrod - gauss) * half);
+        return s;
+    }
+
+    // Samples per batch: the abscissae and values (2 x 8 KiB) stay in L1.
+    static const int kBatch = 1024;
+
+    // Samples per block of the parallel rules; fixed so that the partial
+    // sums, and hence the result, do not depend on the thread count.
+    static const int kParallelBlock = 1 << 16;
+
+    // Sum of weight(i) * f(a + i*h) over i in [first, last), computed in
+    // blocks of kParallelBlock samples in parallel and reduced by treeSum.
+    template <typename Weight>
+    double blockedSum(double a, double h, int first, int last, Weight weight, BlockSum mode) const {
+        if (last <= first) {
+            return 0.0;
+        }
+        const int blocks = (last - first + kParallelBlock - 1) / kParallelBlock;
+        std::vector<double> partial(blocks, 0.0);
+        #pragma omp parallel for schedule(dynamic)
+        for (int blk = 0; blk < blocks; ++blk) {
+            const int begin = first + blk * kParallelBlock;
+            const int end = std::min(begin + kParallelBlock, last);
+            double sum = 0.0;
+            double comp = 0.0;
+            forEachBatch(a, h, begin, end, [&](int i0, const double* y, int count) {
+                for (int k = 0; k < count; ++k) {
+                    const double term = weight(i0 + k) * y[k];
+                    if (mode == BlockSum::Compensated) {
+                        const double t = sum + term;
+                        comp += (std::fabs(sum) >= std::fabs(term)) ? (sum - t) + term
+                                                                     : (term - t) + sum;
+                        sum = t;
+                    } else {
+                        sum += term;
+                    }
+                }
+            });
+            partial[blk] = sum + comp;
+        }
+        return treeSum(partial.data(), blocks);
+    }
+
+    // Pairwise sum in a fixed binary tree: halves [0, n/2) and [n/2, n).
+    static double treeSum(const double* v, int n) {
+        if (n == 1) {
+            return v[0];
+        }
+        const int half = n / 2;
+        return treeSum(v, half) + treeSum(v + half, n - half);
+    }
+
+    // Evaluate f at x_i = a + i*h for i in [first, last) through
+    // Function::evaluate, kBatch points at a time, and hand each batch of
+    // values to body(first index of the batch, values, count) in order.
+    template <typename Body>
+    void forEachBatch(double a, double h, int first, int last, Body body) const {
+        double x[kBatch];
+        double y[kBatch];
+        for (int i0 = first; i0 < last; i0 += kBatch) {
+            const int count = (last - i0 < kBatch) ? last - i0 : kBatch;
+            for (int k = 0; k < count; ++k) {
+                x[k] = a + (i0 + k) * h;
+            }
+            detail::evaluateBatch(function, x, y, count, 0);
+            body(i0, y, count);
+        }
+    }
+
+    const F& function;
 };
 
+template <typename F>
+const int BasicIntegrator<F>::kBatch;
+
+template <typename F>
+const int BasicIntegrator<F>::kParallelBlock;
+
+// Integrator over the virtual Function interface.
+typedef BasicIntegrator<Function> Integrator;
+
+// Integrator specialized for the concrete integrand type, e.g.
+//     CosExpFunction f;
+//     auto integrator = makeIntegrator(f);
+template <typename F>
+BasicIntegrator<F> makeIntegrator(const F& f) {
+    return BasicIntegrator<F>(f);
+}
+
 #endif  // INTEGRATOR_HPP
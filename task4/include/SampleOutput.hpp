@@ -0,0 +1,112 @@
+#ifndef SAMPLE_OUTPUT_HPP
+#define SAMPLE_OUTPUT_HPP
+
+#include "SampledFunction.hpp"
+#include "TabulatedData.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "H5Cpp.h"
+
+// Formats of the (x, f(x)) sample dump written by computeIntegral.
+//   text   : "x f(x)" lines with 16 decimals            (data_<N>.txt)
+//   binary : raw interleaved doubles x0 f0 x1 f1 ...     (data_<N>.dat)
+//   hdf5   : dataset "samples" of shape (N, 2), chunked  (data_<N>.h5)
+enum class OutputFormat {
+    Text,
+    Binary,
+    HDF5
+};
+
+// Pairs written per block (and HDF5 chunk size).
+const int SAMPLE_BLOCK = 1 << 16;
+
+inline OutputFormat parseOutputFormat(const std::string& name) {
+    if (name == "text") {
+        return OutputFormat::Text;
+    }
+    if (name == "binary") {
+        return OutputFormat::Binary;
+    }
+    if (name == "hdf5") {
+        return OutputFormat::HDF5;
+    }
+    throw std::invalid_argument("Unknown output format '" + name + "' (expected text, binary or hdf5).");
+}
+
+inline std::string outputExtension(OutputFormat format) {
+    switch (format) {
+        case OutputFormat::Binary: return ".dat";
+        case OutputFormat::HDF5:   return ".h5";
+        default:                   return ".txt";
+    }
+}
+
+// Text dump: each block of lines is formatted in memory and written at once.
+inline void writeSamplesText(const std::string& path, const SampledFunction& samples, int precision) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        throw std::runtime_error("Unable to open output file: " + path);
+    }
+    std::ostringstream block;
+    block << std::fixed << std::setprecision(precision);
+    for (int first = 0; first < samples.size(); first += SAMPLE_BLOCK) {
+        const int last = std::min(first + SAMPLE_BLOCK, samples.size());
+        block.str("");
+        for (int i = first; i < last; ++i) {
+            block << samples.x(i) << " " << samples[i] << "\n";
+        }
+        const std::string text = block.str();
+        out.write(text.data(), text.size());
+    }
+    out.close();
+    if (!out) {
+        throw std::runtime_error("Error writing output file: " + path);
+    }
+}
+
+// HDF5 dump: dataset "samples" (N x 2 doubles) written one chunk at a time.
+inline void writeSamplesHDF5(const std::string& path, const SampledFunction& samples) {
+    try {
+        H5::H5File file(path, H5F_ACC_TRUNC);
+        const hsize_t n = static_cast<hsize_t>(samples.size());
+        hsize_t dims[2] = { n, 2 };
+        H5::DataSpace fileSpace(2, dims);
+        H5::DSetCreatPropList props;
+        hsize_t chunk[2] = { std::min<hsize_t>(n, SAMPLE_BLOCK), 2 };
+        props.setChunk(2, chunk);
+        H5::DataSet dataset = file.createDataSet("samples", H5::PredType::NATIVE_DOUBLE, fileSpace, props);
+
+        std::vector<double> buffer(2 * SAMPLE_BLOCK);
+        for (int first = 0; first < samples.size(); first += SAMPLE_BLOCK) {
+            const int count = std::min(SAMPLE_BLOCK, samples.size() - first);
+            for (int k = 0; k < count; ++k) {
+                buffer[2 * k] = samples.x(first + k);
+                buffer[2 * k + 1] = samples[first + k];
+            }
+            hsize_t offset[2] = { static_cast<hsize_t>(first), 0 };
+            hsize_t extent[2] = { static_cast<hsize_t>(count), 2 };
+            fileSpace.selectHyperslab(H5S_SELECT_SET, extent, offset);
+            H5::DataSpace memSpace(2, extent);
+            dataset.write(buffer.data(), H5::PredType::NATIVE_DOUBLE, memSpace, fileSpace);
+        }
+        file.close();
+    } catch (const H5::Exception& e) {
+        throw std::runtime_error("Error writing HDF5 file " + path + ": " + e.getDetailMsg());
+    }
+}
+
+// Write the samples to path in the given format.
+inline void writeSamples(const std::string& path, const SampledFunction& samples,
+                         OutputFormat format, int precision) {
+    switch (format) {
+        case OutputFormat::Binary: writeSamplesBinary(path, samples); break;
+        case OutputFormat::HDF5:   writeSamplesHDF5(path, samples); break;
+        default:                   writeSamplesText(path, samples, precision); break;
+    }
+}
+
+#endif  // SAMPLE_OUTPUT_HPP
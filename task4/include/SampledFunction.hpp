@@ -0,0 +1,151 @@
+#ifndef SAMPLED_FUNCTION_HPP
+#define SAMPLED_FUNCTION_HPP
+
+#include "Integrator.hpp"
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+
+// Values of a function on the uniform grid x_i = x0 + i*h, i = 0..n-1.
+// The function is evaluated once, in parallel batches, when the object is
+// built; the data dump and all the sample-based rules below then read the
+// same values.
+class SampledFunction {
+public:
+    template <typename F>
+    SampledFunction(const F& f, double x0, double h, int n) : start(x0), step(h), samples(n) {
+        if (n < 1) {
+            throw std::invalid_argument("Number of sampling points must be at least 1.");
+        }
+        const int batch = 1024;
+        const int batches = (n + batch - 1) / batch;
+        #pragma omp parallel for schedule(static)
+        for (int b = 0; b < batches; ++b) {
+            double x[batch];
+            const int first = b * batch;
+            const int count = std::min(batch, n - first);
+            for (int k = 0; k < count; ++k) {
+                x[k] = x0 + (first + k) * h;
+            }
+            detail::evaluateBatch(f, x, samples.data() + first, count, 0);
+        }
+    }
+
+    int size() const { return static_cast<int>(samples.size()); }
+    double x(int i) const { return start + i * step; }
+    double operator[](int i) const { return samples[i]; }
+    const double* values() const { return samples.data(); }
+    double h() const { return step; }
+
+    // Grid index of x; false if x is not a grid point (up to rounding).
+    bool indexOf(double x, int& index) const {
+        const double r = (x - start) / step;
+        const double i = std::round(r);
+        if (std::fabs(r - i) > 1e-9 || i < 0 || i >= size()) {
+            return false;
+        }
+        index = static_cast<int>(i);
+        return true;
+    }
+
+private:
+    double start;
+    double step;
+    std::vector<double> samples;
+};
+
+// Trapezoidal rule on n samples y[0], y[stride], ... spaced by h (same
+// summation order as Integrator::integrateTrapz).
+inline double integrateTrapzSamples(const double* y, int n, double h, int stride = 1) {
+    if (n < 2) {
+        throw std::invalid_argument("Number of sampling points must be at least 2.");
+    }
+    double sum = 0.5 * (y[0] + y[(n - 1) * stride]);
+    for (int i = 1; i < n - 1; ++i) {
+        sum += y[i * stride];
+    }
+    return sum * h;
+}
+
+// Simpson's rule on n samples spaced by h.  The grid is fixed, so for an
+// even n Simpson covers the first n-3 intervals and Simpson's 3/8 rule the
+// last three.
+inline double integrateSimpsonSamples(const double* y, int n, double h, int stride = 1) {
+    if (n < 3) {
+        throw std::invalid_argument("Number of sampling points must be at least 3.");
+    }
+    const int m = ((n - 1) % 2 == 0) ? n : n - 3;  // points covered by Simpson
+    double result = 0.0;
+    if (m >= 3) {
+        double sum = y[0] + y[(m - 1) * stride];
+        for (int i = 1; i < m - 1; ++i) {
+            if (i % 2 == 0) {
+                sum += 2 * y[i * stride];
+            } else {
+                sum += 4 * y[i * stride];
+            }
+        }
+        result = (h / 3.0) * sum;
+    }
+    if (m != n) {
+        const double* t = y + (n - 4) * stride;
+        result += (3.0 * h / 8.0) * (t[0] + 3.0 * t[stride] + 3.0 * t[2 * stride] + t[3 * stride]);
+    }
+    return result;
+}
+
+// Romberg integration restricted to the n samples spaced by h: level i
+// needs 2^i segments on the grid, so at most 1 + (number of times n-1 is
+// divisible by 2) levels are available.  Stops earlier once
+// |R[i][i] - R[i-1][i-1]| < tol.  evaluations reports the samples read.
+inline RombergResult integrateRombergSamples(const double* y, int n, double h, int maxIter = 10,
+                                             double tol = 1e-12, int stride = 1) {
+    if (n < 2) {
+        throw std::invalid_argument("Number of sampling points must be at least 2.");
+    }
+    if (maxIter < 1) {
+        throw std::invalid_argument("Number of Romberg iterations must be at least 1.");
+    }
+    const int segments = n - 1;
+    int levels = 1;
+    while (levels < maxIter && segments % (1 << levels) == 0) {
+        ++levels;
+    }
+
+    std::vector<double> prev(levels, 0.0);
+    std::vector<double> curr(levels, 0.0);
+    const double width = segments * h;
+    RombergResult result;
+    prev[0] = 0.5 * width * (y[0] + y[segments * stride]);
+    result.value = prev[0];
+    result.error = 0.0;
+    result.levels = 1;
+    result.evaluations = 2;
+
+    for (int i = 1; i < levels; ++i) {
+        const int newPoints = 1 << (i - 1);
+        const int step = segments / (2 * newPoints);
+        double sum = 0.0;
+        for (int k = 0; k < newPoints; ++k) {
+            sum += y[(2 * k + 1) * step * stride];
+        }
+        result.evaluations += newPoints;
+        curr[0] = 0.5 * prev[0] + (width / (2.0 * newPoints)) * sum;
+
+        double factor = 1.0;
+        for (int j = 1; j <= i; ++j) {
+            factor *= 4.0;
+            curr[j] = curr[j-1] + (curr[j-1] - prev[j-1]) / (factor - 1.0);
+        }
+        result.value = curr[i];
+        result.error = std::fabs(curr[i] - prev[i-1]);
+        result.levels = i + 1;
+        if (result.error < tol) {
+            break;
+        }
+        prev.swap(curr);
+    }
+    return result;
+}
+
+#endif  // SAMPLED_FUNCTION_HPP
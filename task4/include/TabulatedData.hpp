@@ -0,0 +1,144 @@
+#ifndef TABULATED_DATA_HPP
+#define TABULATED_DATA_HPP
+
+#include "SampledFunction.hpp"
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Binary sample file: the pairs (x_i, f(x_i)) stored back to back as raw
+// native doubles, x_0 f_0 x_1 f_1 ... (no header), i.e. the text data file
+// without the formatting.  NumPy reads it with
+//     np.fromfile(path, dtype=np.float64).reshape(-1, 2)
+
+// Read-only memory mapping of a binary sample file.
+class MappedSamples {
+public:
+    explicit MappedSamples(const std::string& path) : data(nullptr), bytes(0), count(0) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Unable to open sample file: " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Unable to stat sample file: " + path);
+        }
+        bytes = static_cast<std::size_t>(st.st_size);
+        if (bytes % (2 * sizeof(double)) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Sample file size is not a whole number of (x, f) pairs: " + path);
+        }
+        count = static_cast<int>(bytes / (2 * sizeof(double)));
+        if (bytes > 0) {
+            void* p = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Unable to map sample file: " + path);
+            }
+            data = static_cast<const double*>(p);
+            ::madvise(p, bytes, MADV_SEQUENTIAL);
+        }
+        ::close(fd);
+    }
+
+    ~MappedSamples() {
+        if (data != nullptr) {
+            ::munmap(const_cast<double*>(data), bytes);
+        }
+    }
+
+    MappedSamples(const MappedSamples&) = delete;
+    MappedSamples& operator=(const MappedSamples&) = delete;
+
+    // Number of (x, f) pairs.
+    int size() const { return count; }
+    double x(int i) const { return data[2 * i]; }
+    double f(int i) const { return data[2 * i + 1]; }
+    // Interleaved arrays: x(i) = xs()[2*i], f(i) = fs()[2*i].
+    const double* xs() const { return data; }
+    const double* fs() const { return data + 1; }
+
+private:
+    const double* data;
+    std::size_t bytes;
+    int count;
+};
+
+// Write the samples in the binary format above, in blocks of 2^16 pairs.
+inline void writeSamplesBinary(const std::string& path, const SampledFunction& samples) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open()) {
+        throw std::runtime_error("Unable to open output file: " + path);
+    }
+    const int block = 1 << 16;
+    std::vector<double> buffer(2 * block);
+    for (int first = 0; first < samples.size(); first += block) {
+        const int count = std::min(block, samples.size() - first);
+        for (int k = 0; k < count; ++k) {
+            buffer[2 * k] = samples.x(first + k);
+            buffer[2 * k + 1] = samples[first + k];
+        }
+        out.write(reinterpret_cast<const char*>(buffer.data()), 2 * count * sizeof(double));
+    }
+    out.close();
+    if (!out) {
+        throw std::runtime_error("Error writing output file: " + path);
+    }
+}
+
+// Step of the tabulated abscissae x[0], x[stride], ... if they are equally
+// spaced (to 1e-9 of a step); false otherwise.
+inline bool uniformStep(const double* x, int n, int stride, double& h) {
+    if (n < 2) {
+        return false;
+    }
+    h = (x[(n - 1) * stride] - x[0]) / (n - 1);
+    for (int i = 1; i < n - 1; ++i) {
+        if (std::fabs(x[i * stride] - (x[0] + i * h)) > 1e-9 * std::fabs(h)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Trapezoidal rule on tabulated (x, f) pairs; the abscissae may be unevenly spaced.
+inline double integrateTrapzTabulated(const double* x, const double* f, int n, int stride = 1) {
+    if (n < 2) {
+        throw std::invalid_argument("Number of sampling points must be at least 2.");
+    }
+    double sum = 0.0;
+    for (int i = 0; i < n - 1; ++i) {
+        sum += 0.5 * (x[(i + 1) * stride] - x[i * stride]) * (f[i * stride] + f[(i + 1) * stride]);
+    }
+    return sum;
+}
+
+// Simpson's rule on tabulated (x, f) pairs; requires equally spaced abscissae.
+inline double integrateSimpsonTabulated(const double* x, const double* f, int n, int stride = 1) {
+    double h;
+    if (!uniformStep(x, n, stride, h)) {
+        throw std::invalid_argument("Simpson's rule on tabulated data needs equally spaced abscissae.");
+    }
+    return integrateSimpsonSamples(f, n, h, stride);
+}
+
+// Romberg integration on the grid of tabulated (x, f) pairs; requires
+// equally spaced abscissae (see integrateRombergSamples for the depth).
+inline RombergResult integrateRombergTabulated(const double* x, const double* f, int n,
+                                               int maxIter = 10, double tol = 1e-12, int stride = 1) {
+    double h;
+    if (!uniformStep(x, n, stride, h)) {
+        throw std::invalid_argument("Romberg integration on tabulated data needs equally spaced abscissae.");
+    }
+    return integrateRombergSamples(f, n, h, maxIter, tol, stride);
+}
+
+#endif  // TABULATED_DATA_HPP
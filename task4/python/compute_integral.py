@@ -10,11 +10,18 @@ This script:
   - Computes and prints the absolute differences.
 
 Usage:
-    ./compute_integral.py --N <N_value> --precision <precision_value>
+    ./compute_integral.py --N <N_value> --precision <precision_value> [--format auto|text|binary|hdf5]
 Example:
-    ./compute_integral.py --N 1048577 --precision 16
+    ./compute_integral.py --N 1048577 --precision 16 --format binary
+
+The sample dump may be text (data_<N>.txt), raw binary doubles x0 f0 x1 f1 ...
+(data_<N>.dat, read with numpy.fromfile) or HDF5 (data_<N>.h5, dataset "samples"
+of shape (N, 2), read with h5py).  With --format auto the first existing file
+among .dat, .h5 and .txt is used.
 """
 
+import os
+
 import argparse
 import numpy as np
 from scipy.interpolate import interp1d
@@ -24,8 +31,9 @@ from scipy.integrate import trapezoid, simpson
 # Constants
 # ============================
 DATA_DIR = "./data"
-# The data file is expected to be named as: data_<N>.txt (where N is the sample count used in C++).
-OUTPUT_FILE_TEMPLATE = f"{DATA_DIR}/data_{{N}}.txt"
+# The data file is expected to be named as: data_<N>.<ext> (where N is the sample count used in C++).
+OUTPUT_FILE_TEMPLATE = f"{DATA_DIR}/data_{{N}}{{ext}}"
+FORMAT_EXTENSIONS = {"binary": ".dat", "hdf5": ".h5", "text": ".txt"}
 
 # Integration bounds (matching C++ integration interval)
 A = 0.0
@@ -81,6 +89,35 @@ def load_cpp_integral(method: str, N: int, precision: int, data_dir: str = DATA_
     return np.loadtxt(file_path)
 
 
+# ============================
+# Helper function to load the C++ sample dump
+# ============================
+def load_samples(N: int, fmt: str = "auto") -> np.ndarray:
+    """
+    Load the (x, f(x)) samples written by the C++ program as an (N, 2) array.
+    fmt is one of "text", "binary", "hdf5" or "auto" (the most recently written
+    existing file, so a stale dump in another format is never picked up).
+    """
+    if fmt == "auto":
+        candidates = []
+        for candidate in ("binary", "hdf5", "text"):
+            path = OUTPUT_FILE_TEMPLATE.format(N=N, ext=FORMAT_EXTENSIONS[candidate])
+            if os.path.exists(path):
+                candidates.append((os.path.getmtime(path), candidate))
+        if not candidates:
+            raise FileNotFoundError(f"No sample file data_{N}.(dat|h5|txt) in {DATA_DIR}.")
+        fmt = max(candidates)[1]
+
+    file_path = OUTPUT_FILE_TEMPLATE.format(N=N, ext=FORMAT_EXTENSIONS[fmt])
+    if fmt == "binary":
+        return np.fromfile(file_path, dtype=np.float64).reshape(-1, 2)
+    if fmt == "hdf5":
+        import h5py
+        with h5py.File(file_path, "r") as f:
+            return f["samples"][...]
+    return np.loadtxt(file_path)
+
+
 # ============================
 # Main function
 # ============================
@@ -93,14 +130,16 @@ def main():
                         help="Number of sampling points used in the C++ output file (e.g., 1048577).")
     parser.add_argument("--precision", type=int, required=True,
                         help="Precision used in the C++ output file (e.g., 16).")
+    parser.add_argument("--format", type=str, default="auto",
+                        choices=["auto", "text", "binary", "hdf5"],
+                        help="Format of the C++ sample dump (default: auto-detect).")
     args = parser.parse_args()
     
     cpp_N = args.N
     cpp_precision = args.precision
-    cpp_data_file = OUTPUT_FILE_TEMPLATE.format(N=cpp_N)
 
     # Load full output data generated by the C++ program
-    data = np.loadtxt(cpp_data_file)
+    data = load_samples(cpp_N, args.format)
     
     x_full = data[:, 0]
     fx_full = data[:, 1]
@@ -3,6 +3,10 @@
 # This script runs both the C++ and Python integration codes for a grid of N values,
 # and aggregates only the last output row (the CSV row) from each run into a master CSV file.
 
+# Format of the sample dumps passed between the two codes: binary (default), hdf5 or text.
+# Usage: runExperiments.sh [binary|hdf5|text]
+FORMAT=${1:-binary}
+
 # Master results file.
 RESULTS_FILE="./data/integrals_results.csv"
 
@@ -17,11 +21,11 @@ for N_exp in $(seq 3 24); do
 
     # Run the C++ executable.
     # The C++ code prints a CSV row as its last line.
-    CPP_OUTPUT=$(run computeIntegral ${N} 0 3.141592653589793 | tail -n 1)
+    CPP_OUTPUT=$(run computeIntegral ${N} 0 3.141592653589793 ${FORMAT} | tail -n 1)
 
     # Run the Python script.
     # The Python code prints a CSV row as its last line.
-    PY_OUTPUT=$(run compute_integral --N ${N} --precision 16 | tail -n 1)
+    PY_OUTPUT=$(run compute_integral --N ${N} --precision 16 --format ${FORMAT} | tail -n 1)
 
     # Append only the last output row for each run to the master CSV file.
     echo "${CPP_OUTPUT}" >> ${RESULTS_FILE}
@@ -29,3 +33,9 @@ for N_exp in $(seq 3 24); do
 done
 
 echo "All results saved in ${RESULTS_FILE}"
+
+# Cost and accuracy of every C++ rule (fixed grids up to 2^24 + 1 points,
+# incremental Romberg and adaptive Gauss-Kronrod) in a separate CSV file.
+BENCHMARK_FILE="./data/integrators_benchmark.csv"
+run benchIntegrators 24 > ${BENCHMARK_FILE}
+echo "Integrator benchmark saved in ${BENCHMARK_FILE}"
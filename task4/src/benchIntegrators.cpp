@@ -0,0 +1,73 @@
+// benchIntegrators.cpp
+// Accuracy and cost of the integration rules on f(x) = cos(x) * exp(x) over [0, π/2].
+// Prints one CSV row per run: Method,Parameter,Value,RelError,Evaluations,Seconds
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include "Function.hpp"
+#include "Integrator.hpp"
+
+const double INTEGRATION_A = 0.0;
+const double INTEGRATION_B = M_PI / 2.0;
+const double ANALYTIC_SOLUTION = (std::exp(M_PI / 2.0) - 1.0) / 2.0;
+
+// Seconds per call of run(), repeating short runs so the timer resolution does not matter.
+template <typename Run>
+double timeRun(Run run, int repeats) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        run();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(end - start).count() / repeats;
+}
+
+void printRow(const std::string& method, const std::string& parameter, double value,
+              long long evaluations, double seconds) {
+    std::cout << method << "," << parameter << ","
+              << std::setprecision(17) << value << ","
+              << std::setprecision(6) << (value / ANALYTIC_SOLUTION - 1.0) << ","
+              << evaluations << "," << seconds << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    // Largest grid is 2^maxExp + 1 points (default matches runExperiments.sh).
+    int maxExp = 24;
+    if (argc >= 2) {
+        maxExp = std::stoi(argv[1]);
+    }
+
+    CosExpFunction f;
+    Integrator integrator(f);
+    std::cout << "Method,Parameter,Value,RelError,Evaluations,Seconds\n";
+
+    for (int k = 3; k <= maxExp; ++k) {
+        const int n = (1 << k) + 1;
+        const int repeats = std::max(1, (1 << 20) / n);
+        double value = 0.0;
+        double seconds = timeRun([&] { value = integrator.integrateTrapz(INTEGRATION_A, INTEGRATION_B, n); }, repeats);
+        printRow("Trapz", std::to_string(n), value, n, seconds);
+        seconds = timeRun([&] { value = integrator.integrateSimpson(INTEGRATION_A, INTEGRATION_B, n); }, repeats);
+        printRow("Simpson", std::to_string(n), value, n, seconds);
+        seconds = timeRun([&] { value = integrator.integrateTrapzParallel(INTEGRATION_A, INTEGRATION_B, n); }, repeats);
+        printRow("TrapzParallel", std::to_string(n), value, n, seconds);
+        seconds = timeRun([&] { value = integrator.integrateSimpsonParallel(INTEGRATION_A, INTEGRATION_B, n, BlockSum::Compensated); }, repeats);
+        printRow("SimpsonParallelCompensated", std::to_string(n), value, n, seconds);
+    }
+
+    for (int maxIter = 2; maxIter <= 12; ++maxIter) {
+        RombergResult r;
+        double seconds = timeRun([&] { r = integrator.integrateRombergIncremental(INTEGRATION_A, INTEGRATION_B, maxIter, 1e-12); }, 100);
+        printRow("Romberg", std::to_string(maxIter), r.value, r.evaluations, seconds);
+    }
+
+    for (int e = 3; e <= 15; e += 2) {
+        const double tol = std::pow(10.0, -e);
+        AdaptiveResult r;
+        double seconds = timeRun([&] { r = integrator.integrateGaussKronrod(INTEGRATION_A, INTEGRATION_B, tol); }, 100);
+        printRow("GaussKronrod", "1e-" + std::to_string(e), r.value, r.evaluations, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+// benchTemplatedIntegrator.cpp
+// Virtual (Integrator over Function&) vs. templated (BasicIntegrator<CosExpFunction>
+// and a lambda) integration of f(x) = cos(x) * exp(x) over [0, π/2].
+// Prints one CSV row per rule and N: Method,N,PerPoint,Virtual,Templated,Lambda,Speedup
+// where the timings are seconds per call, PerPoint is a Function without a batch
+// evaluate() (one virtual call per sample) and Speedup = PerPoint / Templated.
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include "Function.hpp"
+#include "Integrator.hpp"
+
+const double INTEGRATION_A = 0.0;
+const double INTEGRATION_B = M_PI / 2.0;
+
+// Best of a few timed runs; short runs are repeated so the timer resolution does not matter.
+template <typename Run>
+double timeRun(Run run, int repeats) {
+    double best = 1e300;
+    for (int trial = 0; trial < 3; ++trial) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < repeats; ++r) {
+            run();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double>(end - start).count() / repeats);
+    }
+    return best;
+}
+
+// Same integrand without a batch evaluate(): the default Function::evaluate
+// makes one virtual call per sample.
+class PointwiseCosExp : public Function {
+public:
+    double operator()(double x) const override {
+        return std::cos(x) * std::exp(x);
+    }
+};
+
+// Times one rule through the four integrators.
+template <typename PerPoint, typename Virtual, typename Templated, typename Lambda>
+void benchRule(const std::string& method, int n, PerPoint runPerPoint, Virtual runVirtual,
+               Templated runTemplated, Lambda runLambda) {
+    const int repeats = std::max(1, (1 << 20) / n);
+    volatile double sink = 0.0;
+    const double tp = timeRun([&] { sink = runPerPoint(); }, repeats);
+    const double tv = timeRun([&] { sink = runVirtual(); }, repeats);
+    const double tt = timeRun([&] { sink = runTemplated(); }, repeats);
+    const double tl = timeRun([&] { sink = runLambda(); }, repeats);
+    (void)sink;
+    std::cout << method << "," << n << ","
+              << std::setprecision(6) << tp << "," << tv << "," << tt << "," << tl << ","
+              << std::setprecision(3) << tp / tt << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    int minExp = 10;
+    int maxExp = 24;
+    if (argc >= 3) {
+        minExp = std::stoi(argv[1]);
+        maxExp = std::stoi(argv[2]);
+    }
+
+    PointwiseCosExp pointwise;
+    CosExpFunction f;
+    const Function& plugin = f;
+    auto lambda = [](double x) { return std::cos(x) * std::exp(x); };
+
+    Integrator perPointIntegrator(pointwise);
+    Integrator virtualIntegrator(plugin);
+    auto templatedIntegrator = makeIntegrator(f);
+    auto lambdaIntegrator = makeIntegrator(lambda);
+
+    std::cout << "Method,N,PerPoint,Virtual,Templated,Lambda,Speedup\n";
+    for (int k = minExp; k <= maxExp; ++k) {
+        const int n = (1 << k) + 1;
+        benchRule("Trapz", n,
+                  [&] { return perPointIntegrator.integrateTrapz(INTEGRATION_A, INTEGRATION_B, n); },
+                  [&] { return virtualIntegrator.integrateTrapz(INTEGRATION_A, INTEGRATION_B, n); },
+                  [&] { return templatedIntegrator.integrateTrapz(INTEGRATION_A, INTEGRATION_B, n); },
+                  [&] { return lambdaIntegrator.integrateTrapz(INTEGRATION_A, INTEGRATION_B, n); });
+        benchRule("Simpson", n,
+                  [&] { return perPointIntegrator.integrateSimpson(INTEGRATION_A, INTEGRATION_B, n); },
+                  [&] { return virtualIntegrator.integrateSimpson(INTEGRATION_A, INTEGRATION_B, n); },
+                  [&] { return templatedIntegrator.integrateSimpson(INTEGRATION_A, INTEGRATION_B, n); },
+                  [&] { return lambdaIntegrator.integrateSimpson(INTEGRATION_A, INTEGRATION_B, n); });
+        // k + 1 levels with tol = 0 use all 2^k + 1 points.
+        benchRule("Romberg", n,
+                  [&] { return perPointIntegrator.integrateRomberg(INTEGRATION_A, INTEGRATION_B, k + 1, 0.0); },
+                  [&] { return virtualIntegrator.integrateRomberg(INTEGRATION_A, INTEGRATION_B, k + 1, 0.0); },
+                  [&] { return templatedIntegrator.integrateRomberg(INTEGRATION_A, INTEGRATION_B, k + 1, 0.0); },
+                  [&] { return lambdaIntegrator.integrateRomberg(INTEGRATION_A, INTEGRATION_B, k + 1, 0.0); });
+    }
+    return 0;
+}
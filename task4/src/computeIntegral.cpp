@@ -6,6 +6,8 @@
 #include "HelperFunctions.hpp"
 #include "Function.hpp"
 #include "Integrator.hpp"
+#include "SampledFunction.hpp"
+#include "SampleOutput.hpp"
 
 // Constants for data output and integration bounds.
 const std::string DATA_DIR = "./data";
@@ -37,27 +39,29 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    // Create the data output file path.
-    std::string DATA_FILE = DATA_DIR + "/" + DATA_NAME + "_" + std::to_string(params.N) + ".txt";
-    std::ofstream outFile;
+    // Create the data output file path; the extension follows the output format.
+    OutputFormat format;
     try {
-        outFile = openOutputFile(DATA_FILE);
+        format = parseOutputFormat(params.output_format);
     } catch (const std::exception& e) {
-        std::cerr << "File Error: " << e.what() << std::endl;
+        std::cerr << "Input Error: " << e.what() << std::endl;
         return 1;
     }
+    std::string DATA_FILE = DATA_DIR + "/" + DATA_NAME + "_" + std::to_string(params.N) + outputExtension(format);
 
     // Create an instance of the function f(x) = cos(x) * exp(x)
     CosExpFunction f;
 
-    // Generate and write N uniformly spaced points over [params.x_inf, params.x_sup].
+    // Sample N uniformly spaced points over [params.x_inf, params.x_sup] once;
+    // the data file and the integration rules below all read these values.
     double dx = (params.x_sup - params.x_inf) / (params.N - 1);
-    for (int i = 0; i < params.N; ++i) {
-        double x = params.x_inf + i * dx;
-        outFile << std::fixed << std::setprecision(OUTPUT_PRECISION)
-                << x << " " << f(x) << "\n";
+    SampledFunction samples(f, params.x_inf, dx, params.N);
+    try {
+        writeSamples(DATA_FILE, samples, format, OUTPUT_PRECISION);
+    } catch (const std::exception& e) {
+        std::cerr << "File Error: " << e.what() << std::endl;
+        return 1;
     }
-    outFile.close();
 
     std::cout << "Generated " << params.N << " points in the range ["
               << params.x_inf << ", " << params.x_sup << "]." << std::endl;
@@ -70,11 +74,27 @@ int main(int argc, char* argv[]) {
     // given dx from the generated data.
     const int N_AB = static_cast<int>(std::round((INTEGRATION_B - INTEGRATION_A) / dx)) + 1;
 
+    // Reuse the samples when both bounds are grid points; otherwise the rules
+    // evaluate f on their own grid over [INTEGRATION_A, INTEGRATION_B].
+    int first = 0, last = 0;
+    const bool onGrid = samples.indexOf(INTEGRATION_A, first) &&
+                        samples.indexOf(INTEGRATION_B, last) && last - first + 1 == N_AB;
+
     double integralTrapz, integralSimpson, integralRomberg;
+    RombergResult romberg;
     try {
-        integralTrapz   = integrator.integrateTrapz(INTEGRATION_A, INTEGRATION_B, N_AB);
-        integralSimpson = integrator.integrateSimpson(INTEGRATION_A, INTEGRATION_B, N_AB);
-        integralRomberg = integrator.integrateRomberg(INTEGRATION_A, INTEGRATION_B, 10, 1e-12);
+        if (onGrid) {
+            const double* y = samples.values() + first;
+            integralTrapz   = integrateTrapzSamples(y, N_AB, dx);
+            integralSimpson = integrateSimpsonSamples(y, N_AB, dx);
+            romberg         = integrator.integrateRombergIncremental(INTEGRATION_A, INTEGRATION_B, 10, 1e-12, y, N_AB);
+        } else {
+            std::cout << "Integration bounds are not on the sample grid; evaluating f directly." << std::endl;
+            integralTrapz   = integrator.integrateTrapz(INTEGRATION_A, INTEGRATION_B, N_AB);
+            integralSimpson = integrator.integrateSimpson(INTEGRATION_A, INTEGRATION_B, N_AB);
+            romberg         = integrator.integrateRombergIncremental(INTEGRATION_A, INTEGRATION_B, 10, 1e-12);
+        }
+        integralRomberg = romberg.value;
     } catch (const std::exception& e) {
         std::cerr << "Integration Error: " << e.what() << std::endl;
         return 1;
@@ -87,6 +107,8 @@ int main(int argc, char* argv[]) {
     printIntegral(integralSimpson, OUTPUT_PRECISION, N_AB, ANALYTIC_SOLUTION);
     std::cout << "\nRomberg Integration:" << std::endl;
     printIntegral(integralRomberg, OUTPUT_PRECISION, N_AB, ANALYTIC_SOLUTION);
+    std::cout << "Romberg Levels: " << romberg.levels
+              << ", Function Evaluations: " << romberg.evaluations << std::endl;
 
     // Save the integral results to files.
     try {
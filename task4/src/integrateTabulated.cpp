@@ -0,0 +1,86 @@
+// integrateTabulated.cpp
+// Integrate tabulated (x, f(x)) samples read from a memory-mapped binary data file.
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <string>
+#include "HelperFunctions.hpp"
+#include "TabulatedData.hpp"
+
+const int OUTPUT_PRECISION = 16;
+
+// Default integration interval: [0, π/2] (as in computeIntegral).
+const double INTEGRATION_A = 0.0;
+const double INTEGRATION_B = M_PI / 2.0;
+
+// Analytic solution for comparison.
+const double ANALYTIC_SOLUTION = (std::exp(M_PI / 2.0) - 1.0) / 2.0;
+
+int main(int argc, char* argv[]) {
+    if (argc != 2 && argc != 4) {
+        std::cerr << "Usage:\n"
+                     "  integrateTabulated <data.dat> [<a> <b>]" << std::endl;
+        return 1;
+    }
+    const std::string dataFile = argv[1];
+    double a = INTEGRATION_A;
+    double b = INTEGRATION_B;
+    if (argc == 4) {
+        try {
+            a = std::stod(argv[2]);
+            b = std::stod(argv[3]);
+        } catch (const std::exception& e) {
+            std::cerr << "Input Error: Invalid integration bounds." << std::endl;
+            return 1;
+        }
+    }
+
+    try {
+        MappedSamples samples(dataFile);
+
+        // Samples with a <= x <= b (allowing for rounding of the abscissae).
+        const double slack = 1e-9 * std::fabs(b - a);
+        int first = 0;
+        while (first < samples.size() && samples.x(first) < a - slack) {
+            ++first;
+        }
+        int last = first;
+        while (last < samples.size() && samples.x(last) <= b + slack) {
+            ++last;
+        }
+        const int n = last - first;
+        std::cout << "Loaded " << samples.size() << " samples from " << dataFile
+                  << ", " << n << " in [" << a << ", " << b << "]." << std::endl;
+
+        const double* x = samples.xs() + 2 * first;
+        const double* f = samples.fs() + 2 * first;
+        const double integralTrapz   = integrateTrapzTabulated(x, f, n, 2);
+        const double integralSimpson = integrateSimpsonTabulated(x, f, n, 2);
+        const RombergResult romberg  = integrateRombergTabulated(x, f, n, 20, 1e-12, 2);
+
+        std::cout << "\nTrapezoidal Rule:" << std::endl;
+        printIntegral(integralTrapz, OUTPUT_PRECISION, n, ANALYTIC_SOLUTION);
+        std::cout << "\nSimpson's Rule:" << std::endl;
+        printIntegral(integralSimpson, OUTPUT_PRECISION, n, ANALYTIC_SOLUTION);
+        std::cout << "\nRomberg Integration (on the sample grid):" << std::endl;
+        printIntegral(romberg.value, OUTPUT_PRECISION, n, ANALYTIC_SOLUTION);
+        std::cout << "Romberg Levels: " << romberg.levels
+                  << ", Samples Used: " << romberg.evaluations << std::endl;
+        if (romberg.levels < 2 || romberg.error >= 1e-12) {
+            std::cout << "Note: " << n - 1 << " intervals allow only " << romberg.levels
+                      << " Romberg levels on this grid (use 2^k + 1 samples)." << std::endl;
+        }
+
+        // Output a CSV row (fields: Language, N_AB, Trapz, Simpson, Romberg, Analytic)
+        std::cout << "tab," << n << ","
+                  << std::fixed << std::setprecision(OUTPUT_PRECISION)
+                  << integralTrapz << ","
+                  << integralSimpson << ","
+                  << romberg.value << ","
+                  << ANALYTIC_SOLUTION << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Integration Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+#ifndef ALIGNED_ALLOCATOR_HPP
+#define ALIGNED_ALLOCATOR_HPP
+
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+
+/**
+ * @brief Allocator that aligns storage and default-initializes elements.
+ *
+ * std::vector<double>::resize(n) value-initializes: it writes n zeros, serially,
+ * before a kernel overwrites them.  With this allocator, resize() only reserves
+ * memory: elements constructed without arguments are default-initialized, which
+ * for double means left unwritten, and the OS maps the pages on the first write.
+ * That first write then happens inside the kernel, so a parallel kernel also
+ * places every page on the NUMA node of the thread that uses it.  Elements
+ * constructed with a value (push_back, resize(n, v), copies) are unchanged.
+ *
+ * Storage is aligned to Alignment bytes (default 64, one cache line), so
+ * vector loads and stores never split a cache line.
+ */
+template <typename T, std::size_t Alignment = 64>
+class DefaultInitAllocator {
+public:
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind { typedef DefaultInitAllocator<U, Alignment> other; };
+
+    DefaultInitAllocator() noexcept {}
+    template <typename U>
+    DefaultInitAllocator(const DefaultInitAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        void* p = nullptr;
+        if (posix_memalign(&p, Alignment, n * sizeof(T) > 0 ? n * sizeof(T) : Alignment) != 0) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t) noexcept { std::free(p); }
+
+    // No arguments: default-initialize (no zero fill).
+    template <typename U>
+    void construct(U* p) { ::new (static_cast<void*>(p)) U; }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) { ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+};
+
+template <typename T, typename U, std::size_t A>
+bool operator==(const DefaultInitAllocator<T, A>&, const DefaultInitAllocator<U, A>&) { return true; }
+template <typename T, typename U, std::size_t A>
+bool operator!=(const DefaultInitAllocator<T, A>&, const DefaultInitAllocator<U, A>&) { return false; }
+
+/// Cache-line aligned vector whose resize() does not zero-fill: use it for kernel outputs.
+template <typename T>
+using AlignedVector = std::vector<T, DefaultInitAllocator<T> >;
+
+#endif // ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,92 @@
+#ifndef DAXPY_SWEEP_HPP
+#define DAXPY_SWEEP_HPP
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * @brief Reductions of a DAXPY scan d_k = a_k * x + y in one pass over x and y.
+ *
+ * Calling a DAXPY once per scalar streams x and y from memory K times. When a
+ * parameter scan only needs Σ_i d_k[i] and Σ_i d_k[i]² for every k,
+ * daxpy_sweep_moments() computes them without storing any d_k. The index range
+ * is cut into chunks of kSweepChunk elements that OpenMP threads share. Each
+ * chunk is walked in tiles of kSweepTile elements (16 KiB of x and y, which
+ * stay in L1), and every scalar is applied to a tile before moving to the next.
+ * The memory traffic is one pass over x and y whatever K is. The tile sums are
+ * combined in a fixed order, so the results do not depend on the number of
+ * threads.
+ *
+ * There is deliberately no batched form that stores all K outputs. Writing
+ * K·n doubles sends them to memory, and that is slower than K separate DAXPY
+ * calls into a reused, cache-resident output.
+ */
+
+// Elements per OpenMP work chunk and per L1 tile.
+const std::size_t kSweepChunk = std::size_t(1) << 16;
+const std::size_t kSweepTile = 1024;
+
+/// Per-scalar reductions from daxpy_sweep_moments().
+struct SweepMoments {
+    std::vector<double> sum;          // Σ_i d_k[i]
+    std::vector<double> sum_squares;  // Σ_i d_k[i]²
+};
+
+/**
+ * @brief Σ_i d_k[i] and Σ_i d_k[i]² of d_k = a[k] * x + y for every k, without
+ *        storing any d_k.
+ * @throws std::invalid_argument if x.size() != y.size().
+ */
+inline SweepMoments daxpy_sweep_moments(const std::vector<double>& a,
+                                        const std::vector<double>& x,
+                                        const std::vector<double>& y)
+{
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Vectors x and y must have the same size.");
+    }
+    const std::size_t n = x.size();
+    const std::size_t K = a.size();
+    const long long chunks = static_cast<long long>((n + kSweepChunk - 1) / kSweepChunk);
+    // Per chunk: K sums followed by K sums of squares.
+    std::vector<double> partial(static_cast<std::size_t>(chunks) * 2 * K, 0.0);
+    const double* xp = x.data();
+    const double* yp = y.data();
+
+    #pragma omp parallel for schedule(static)
+    for (long long c = 0; c < chunks; ++c) {
+        const std::size_t begin = static_cast<std::size_t>(c) * kSweepChunk;
+        const std::size_t end = (begin + kSweepChunk < n) ? begin + kSweepChunk : n;
+        double* sum = partial.data() + static_cast<std::size_t>(c) * 2 * K;
+        double* sum_squares = sum + K;
+        for (std::size_t t0 = begin; t0 < end; t0 += kSweepTile) {
+            const std::size_t t1 = (t0 + kSweepTile < end) ? t0 + kSweepTile : end;
+            for (std::size_t k = 0; k < K; ++k) {
+                const double ak = a[k];
+                double s = 0.0, q = 0.0;
+                #pragma omp simd reduction(+:s, q)
+                for (std::size_t i = t0; i < t1; ++i) {
+                    const double di = ak * xp[i] + yp[i];
+                    s += di;
+                    q += di * di;
+                }
+                sum[k] += s;
+                sum_squares[k] += q;
+            }
+        }
+    }
+
+    SweepMoments m;
+    m.sum.assign(K, 0.0);
+    m.sum_squares.assign(K, 0.0);
+    for (long long c = 0; c < chunks; ++c) {
+        const double* sum = partial.data() + static_cast<std::size_t>(c) * 2 * K;
+        for (std::size_t k = 0; k < K; ++k) {
+            m.sum[k] += sum[k];
+            m.sum_squares[k] += sum[K + k];
+        }
+    }
+    return m;
+}
+
+#endif // DAXPY_SWEEP_HPP
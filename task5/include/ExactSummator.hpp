@@ -0,0 +1,229 @@
+#ifndef EXACT_SUMMATOR_HPP
+#define EXACT_SUMMATOR_HPP
+
+#include "Summator.hpp"
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+/**
+ * @brief Fixed-point superaccumulator: exact sum of any number of doubles.
+ *
+ * Every finite double is an integer multiple of 2^-1074 below 2^1024, so a
+ * sum of doubles is an integer of about 2100 bits in units of 2^-1074.
+ * That integer is stored as kChunks signed 64-bit chunks with 32 bits each:
+ *
+ *     value = Σ_k chunk[k] · 2^(32k - 1074)
+ *
+ * add() splits the 53-bit mantissa of x at its bit position (taken from the
+ * exponent field) over at most three chunks and adds the pieces without
+ * propagating carries. Each piece is below 2^32, so 2^30 additions fit in
+ * the 64-bit chunks before normalize() has to propagate the carries. No
+ * rounding ever happens. result() rounds the exact integer once, to the
+ * nearest double (ties to even), so the sum is correctly rounded whatever
+ * the order of the terms or the conditioning of the data.
+ *
+ * Infinities and NaNs follow IEEE rules: the result is NaN if a NaN or
+ * both infinities occur, otherwise ±inf if one of them occurs.
+ */
+class SuperAccumulator {
+public:
+    SuperAccumulator() : chunk(kChunks, 0), pending(0), posInf(false), negInf(false), nan(false) {}
+
+    void add(double x) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &x, sizeof bits);
+        const int biased = static_cast<int>((bits >> 52) & 0x7ff);
+        std::uint64_t mant = bits & ((std::uint64_t(1) << 52) - 1);
+        if (biased == 0x7ff) {
+            if (mant != 0) {
+                nan = true;
+            } else if (bits >> 63) {
+                negInf = true;
+            } else {
+                posInf = true;
+            }
+            return;
+        }
+        // Position of the mantissa's lowest bit in units of 2^-1074.
+        int pos = 0;
+        if (biased != 0) {
+            mant |= std::uint64_t(1) << 52;
+            pos = biased - 1;
+        }
+        const int k = pos >> 5;
+        const int shift = pos & 31;
+        // mant << shift spans up to 85 bits: three 32-bit pieces.
+        const std::uint64_t lo = (mant << shift) & 0xffffffffu;
+        const std::uint64_t mid = (mant >> (32 - shift)) & 0xffffffffu;
+        const std::uint64_t hi = (shift == 0) ? 0 : (mant >> (64 - shift));
+        const std::int64_t sign = (bits >> 63) ? -1 : 1;
+        chunk[k] += sign * static_cast<std::int64_t>(lo);
+        chunk[k + 1] += sign * static_cast<std::int64_t>(mid);
+        chunk[k + 2] += sign * static_cast<std::int64_t>(hi);
+        if (++pending == kMaxPending) {
+            normalize();
+        }
+    }
+
+    void add(const double* x, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            add(x[i]);
+        }
+    }
+
+    // Exact merge: the chunks of the two integers are simply added.
+    void merge(const SuperAccumulator& other) {
+        SuperAccumulator o = other;
+        o.normalize();
+        normalize();
+        for (int k = 0; k < kChunks; ++k) {
+            chunk[k] += o.chunk[k];
+        }
+        pending = 1;
+        posInf = posInf || o.posInf;
+        negInf = negInf || o.negInf;
+        nan = nan || o.nan;
+    }
+
+    // The exact sum rounded to the nearest double.
+    double result() const {
+        if (nan || (posInf && negInf)) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (posInf) {
+            return std::numeric_limits<double>::infinity();
+        }
+        if (negInf) {
+            return -std::numeric_limits<double>::infinity();
+        }
+
+        SuperAccumulator a = *this;
+        a.normalize();
+        // After normalize() the lower chunks are in [0, 2^32) and the sign is
+        // that of the top chunk; negate to work on the magnitude.
+        const bool negative = a.chunk[kChunks - 1] < 0;
+        if (negative) {
+            for (int k = 0; k < kChunks; ++k) {
+                a.chunk[k] = -a.chunk[k];
+            }
+            a.normalize();
+        }
+
+        // Highest non-zero bit.
+        int top = kChunks - 1;
+        while (top >= 0 && a.chunk[top] == 0) {
+            --top;
+        }
+        if (top < 0) {
+            return 0.0;
+        }
+        int msb = 32 * top;
+        for (std::uint64_t c = static_cast<std::uint64_t>(a.chunk[top]); c > 1; c >>= 1) {
+            ++msb;
+        }
+
+        double magnitude;
+        if (msb < 53) {
+            // Fits in a mantissa: exact (this covers all subnormal results).
+            magnitude = std::ldexp(static_cast<double>(a.bitsBelow(msb + 1, 0)), -1074);
+        } else {
+            // Keep 53 bits, round to nearest even with the guard bit and the
+            // sticky OR of everything below it.
+            const int low = msb - 52;
+            std::uint64_t m = a.bitsBelow(53, low);
+            const bool guard = a.bit(low - 1);
+            const bool sticky = a.anyBelow(low - 1);
+            if (guard && (sticky || (m & 1))) {
+                ++m;
+            }
+            magnitude = std::ldexp(static_cast<double>(m), low - 1074);
+        }
+        return negative ? -magnitude : magnitude;
+    }
+
+private:
+    // 2^-1074 .. beyond 2^1024 with room for 2^60 terms of maximal size.
+    static const int kChunks = 70;
+    // Additions between carry propagations (each adds < 2^32 per chunk).
+    static const std::int64_t kMaxPending = std::int64_t(1) << 30;
+
+    // Propagate carries so that chunk[0 .. kChunks-2] are in [0, 2^32).
+    void normalize() {
+        for (int k = 0; k < kChunks - 1; ++k) {
+            const std::int64_t carry = chunk[k] >> 32;  // floor division
+            chunk[k] -= carry * (std::int64_t(1) << 32);
+            chunk[k + 1] += carry;
+        }
+        pending = 0;
+    }
+
+    // Bit p of the normalized non-negative integer.
+    bool bit(int p) const {
+        return (static_cast<std::uint64_t>(chunk[p >> 5]) >> (p & 31)) & 1;
+    }
+
+    // True if any bit below position p is set.
+    bool anyBelow(int p) const {
+        for (int k = 0; k < (p >> 5); ++k) {
+            if (chunk[k] != 0) {
+                return true;
+            }
+        }
+        const std::uint64_t mask = (std::uint64_t(1) << (p & 31)) - 1;
+        return (static_cast<std::uint64_t>(chunk[p >> 5]) & mask) != 0;
+    }
+
+    // The count (≤ 64) bits starting at position low.
+    std::uint64_t bitsBelow(int count, int low) const {
+        std::uint64_t m = 0;
+        for (int p = low + count - 1; p >= low; --p) {
+            m = (m << 1) | (bit(p) ? 1 : 0);
+        }
+        return m;
+    }
+
+    std::vector<std::int64_t> chunk;
+    std::int64_t pending;
+    bool posInf;
+    bool negInf;
+    bool nan;
+};
+
+/**
+ * @brief Correctly rounded summation.
+ *
+ * OpenMP threads fill private SuperAccumulators over parts of the vector,
+ * and the accumulators are merged exactly. The result is the exact sum
+ * rounded once to the nearest double, independent of thread count, order,
+ * conditioning and of how the data is split into streamed blocks.
+ */
+class ExactSummator : public Summator {
+public:
+    struct State {
+        SuperAccumulator total;
+
+        void add(const double* x, std::size_t n) {
+            const long long count = static_cast<long long>(n);
+            #pragma omp parallel
+            {
+                SuperAccumulator part;
+                #pragma omp for schedule(static) nowait
+                for (long long i = 0; i < count; ++i) {
+                    part.add(x[i]);
+                }
+                #pragma omp critical
+                total.merge(part);
+            }
+        }
+        void merge(const State& other) { total.merge(other.total); }
+        double result() const { return total.result(); }
+    };
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
+};
+
+#endif // EXACT_SUMMATOR_HPP
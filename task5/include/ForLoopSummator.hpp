@@ -6,13 +6,19 @@
 // Implementation that sums the vector using a plain for loop.
 class ForLoopSummator : public Summator {
 public:
-    double sum(const std::vector<double>& vec) const override {
+    struct State {
         double s = 0.0;
-        for (size_t i = 0; i < vec.size(); ++i) {
-            s += vec[i];
+
+        void add(const double* x, std::size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                s += x[i];
+            }
         }
-        return s;
-    }
+        void merge(const State& other) { s += other.s; }
+        double result() const { return s; }
+    };
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
 };
 
 #endif // FORLOOP_SUMMATOR_HPP
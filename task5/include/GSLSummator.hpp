@@ -9,22 +9,29 @@
 /**
  * @brief GSL-based summation using gsl_vector_sum.
  *
- * This implementation allocates a GSL vector, copies the data from the input
- * std::vector into it, calls gsl_vector_sum() to compute the sum, and then frees
- * the allocated vector.
+ * Each range passed to the accumulator is wrapped in a gsl_vector_const_view of
+ * the caller's buffer, so nothing is allocated or copied. gsl_vector_sum() sums
+ * the view, and the sums of consecutive ranges are added one after another.
  */
 class GSLSummator : public Summator {
 public:
-    double sum(const std::vector<double>& vec) const override {
-        size_t N = vec.size();
-        gsl_vector* v = gsl_vector_alloc(N);
-        for (size_t i = 0; i < N; ++i) {
-            gsl_vector_set(v, i, vec[i]);
+    // Block sums from GSL, added one after another.
+    struct State {
+        double s = 0.0;
+
+        void add(const double* x, std::size_t n) {
+            if (n == 0) {
+                return;
+            }
+            // A view wraps the caller's buffer, no copy is made.
+            gsl_vector_const_view v = gsl_vector_const_view_array(x, n);
+            s += gsl_vector_sum(&v.vector);  // Uses GSL's vector-sum routine.
         }
-        double s = gsl_vector_sum(v);  // Uses GSL's vector-sum routine.
-        gsl_vector_free(v);
-        return s;
-    }
+        void merge(const State& other) { s += other.s; }
+        double result() const { return s; }
+    };
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
 };
 
-#endif // GSL_SUMMATOR_HPP
\ No newline at end of file
+#endif // GSL_SUMMATOR_HPP
@@ -7,17 +7,30 @@
 // Implementation using the Kahan summation algorithm to reduce round-off error.
 class KahanSummator : public Summator {
 public:
-    double sum(const std::vector<double>& vec) const override {
+    struct State {
         double sum = 0.0;
         double c = 0.0; // Compensation for lost low-order bits.
-        for (size_t i = 0; i < vec.size(); ++i) {
-            double y = vec[i] - c;
+
+        void add(double x) {
+            double y = x - c;
             double t = sum + y;
             c = (t - sum) - y;
             sum = t;
         }
-        return sum;
-    }
+        void add(const double* x, std::size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                add(x[i]);
+            }
+        }
+        // The other part's value is other.sum - other.c; add both terms.
+        void merge(const State& other) {
+            add(other.sum);
+            add(-other.c);
+        }
+        double result() const { return sum; }
+    };
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
 };
 
 #endif // KAHAN_SUMMATOR_HPP
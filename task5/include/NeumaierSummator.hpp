@@ -5,24 +5,49 @@
 #include <vector>
 #include <cmath>
 
+// Running state of a Neumaier sum: the rounded sum and the accumulated
+// low-order bits lost by each addition.
+struct NeumaierState {
+    double sum = 0.0;
+    double c = 0.0;  // Running compensation for lost low-order bits.
+
+    void add(double x) {
+        double t = sum + x;
+        if (std::fabs(sum) >= std::fabs(x)) {
+            c += (sum - t) + x;
+        } else {
+            c += (x - t) + sum;
+        }
+        sum = t;
+    }
+
+    void add(const double* x, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            add(x[i]);
+        }
+    }
+
+    // Combine with the state of another part of the data: the two sums are
+    // added with an exact two-sum, whose rounding error joins the
+    // compensations, so no low-order bits are lost in the merge.
+    void merge(const NeumaierState& other) {
+        double t = sum + other.sum;
+        double bp = t - sum;
+        double err = (sum - (t - bp)) + (other.sum - bp);
+        sum = t;
+        c += other.c + err;
+    }
+
+    double result() const { return sum + c; }
+};
+
 // NeumaierSummator implements the improved Kahan–Babuška (Neumaier) summation algorithm.
 class NeumaierSummator : public Summator {
 public:
-    double sum(const std::vector<double>& vec) const override {
-        double sum = 0.0;
-        double c = 0.0;  // Running compensation for lost low-order bits.
-        
-        for (size_t i = 0; i < vec.size(); ++i) {
-            double t = sum + vec[i];
-            if (std::fabs(sum) >= std::fabs(vec[i])) {
-                c += (sum - t) + vec[i];
-            } else {
-                c += (vec[i] - t) + sum;
-            }
-            sum = t;
-        }
-        return sum + c;  // Apply the correction once at the end.
-    }
+    typedef NeumaierState State;
+
+    // The correction is applied once at the end, in State::result().
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
 };
 
 #endif // NEUMAIER_SUMMATOR_HPP
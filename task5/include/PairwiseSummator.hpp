@@ -11,22 +11,36 @@
 // numerically stable than a simple iterative summation.
 class PairwiseSummator : public Summator {
 public:
-    double sum(const std::vector<double>& vec) const override {
-        return pairwiseSum(vec, 0, vec.size());
-    }
+    // Each streamed block is summed pairwise; the block sums are kept and
+    // combined pairwise in result(), so the error still grows with log n.
+    struct State {
+        std::vector<double> partial;
+
+        void add(const double* x, std::size_t n) {
+            if (n > 0) {
+                partial.push_back(pairwiseSum(x, 0, n));
+            }
+        }
+        void merge(const State& other) {
+            partial.insert(partial.end(), other.partial.begin(), other.partial.end());
+        }
+        double result() const { return pairwiseSum(partial.data(), 0, partial.size()); }
+    };
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
 
 private:
-    // Recursively sums the elements in vec from index [start, end).
-    double pairwiseSum(const std::vector<double>& vec, std::size_t start, std::size_t end) const {
+    // Recursively sums the elements in x from index [start, end).
+    static double pairwiseSum(const double* x, std::size_t start, std::size_t end) {
         std::size_t n = end - start;
         if (n == 0)
             return 0.0;
         if (n == 1)
-            return vec[start];
+            return x[start];
         // Split the array into two halves.
         std::size_t mid = start + n / 2;
-        double leftSum = pairwiseSum(vec, start, mid);
-        double rightSum = pairwiseSum(vec, mid, end);
+        double leftSum = pairwiseSum(x, start, mid);
+        double rightSum = pairwiseSum(x, mid, end);
         return leftSum + rightSum;
     }
 };
@@ -0,0 +1,59 @@
+#ifndef PARALLEL_NEUMAIER_SUMMATOR_HPP
+#define PARALLEL_NEUMAIER_SUMMATOR_HPP
+
+#include "Summator.hpp"
+#include "NeumaierSummator.hpp"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Multithreaded Neumaier summation with exactly merged partial states.
+ *
+ * The vector is cut into fixed blocks of kBlock elements. OpenMP threads sum
+ * the blocks independently, each into its own NeumaierState (sum plus
+ * compensation), and the block states are then merged in block order with
+ * NeumaierState::merge, which adds the partial sums with an error-free
+ * two-sum. The accuracy is that of a sequential Neumaier sum, and because
+ * the blocks and the merge order do not depend on the thread count, the
+ * result is the same for any number of threads.
+ */
+class ParallelNeumaierSummator : public Summator {
+public:
+    // Each streamed block is summed in parallel as above; its merged state
+    // then joins the running state with one more exact merge.
+    struct State {
+        NeumaierState total;
+
+        void add(const double* x, std::size_t n) {
+            const long long blocks = static_cast<long long>((n + kBlock - 1) / kBlock);
+            std::vector<NeumaierState> partial(blocks);
+
+            #pragma omp parallel for schedule(static)
+            for (long long b = 0; b < blocks; ++b) {
+                const std::size_t begin = static_cast<std::size_t>(b) * kBlock;
+                const std::size_t end = (begin + kBlock < n) ? begin + kBlock : n;
+                NeumaierState state;
+                for (std::size_t i = begin; i < end; ++i) {
+                    state.add(x[i]);
+                }
+                partial[b] = state;
+            }
+
+            NeumaierState block;
+            for (long long b = 0; b < blocks; ++b) {
+                block.merge(partial[b]);
+            }
+            total.merge(block);
+        }
+        void merge(const State& other) { total.merge(other.total); }
+        double result() const { return total.result(); }
+    };
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
+
+private:
+    // Elements per block (128 KiB of doubles).
+    static const std::size_t kBlock = std::size_t(1) << 14;
+};
+
+#endif // PARALLEL_NEUMAIER_SUMMATOR_HPP
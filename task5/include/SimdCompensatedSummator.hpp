@@ -0,0 +1,148 @@
+#ifndef SIMD_COMPENSATED_SUMMATOR_HPP
+#define SIMD_COMPENSATED_SUMMATOR_HPP
+
+#include "Summator.hpp"
+#include "NeumaierSummator.hpp"
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * @brief Multi-lane compensated summation written for SIMD code generation.
+ *
+ * A sequential compensated sum is a chain of four dependent floating-point
+ * operations per element. Here element i goes to lane i % kLanes, and each
+ * lane keeps its own (sum, compensation) pair. The lane updates are
+ * independent, so the compiler turns the inner `#pragma omp simd` loop into
+ * vector instructions (kLanes = 16 fills four AVX2 registers, or two
+ * AVX-512 registers, and hides the add latency). The Neumaier branch
+ * becomes a select. At the end the lanes are combined with
+ * NeumaierState::merge (an exact two-sum), so the horizontal reduction is
+ * compensated too.
+ *
+ * The compensation only survives if the compiler may not reassociate, so
+ * never build with -ffast-math.
+ */
+namespace simd_sum {
+
+const std::size_t kLanes = 16;
+
+// Kahan update of every lane with x[0..kLanes).
+inline void kahan_lanes(double* s, double* c, const double* x) {
+    #pragma omp simd
+    for (std::size_t l = 0; l < kLanes; ++l) {
+        const double y = x[l] - c[l];
+        const double t = s[l] + y;
+        c[l] = (t - s[l]) - y;
+        s[l] = t;
+    }
+}
+
+// Neumaier update of every lane with x[0..kLanes).
+inline void neumaier_lanes(double* s, double* c, const double* x) {
+    #pragma omp simd
+    for (std::size_t l = 0; l < kLanes; ++l) {
+        const double t = s[l] + x[l];
+        c[l] += (std::fabs(s[l]) >= std::fabs(x[l])) ? (s[l] - t) + x[l] : (x[l] - t) + s[l];
+        s[l] = t;
+    }
+}
+
+// Lane sums and compensations of a multi-lane Kahan (Kahan = true) or
+// Neumaier sum. Up to kLanes - 1 trailing elements of a streamed block wait
+// in `pending` until the next block completes the group, so streaming in
+// blocks of any length gives the same result as one call over all the data.
+template <bool Kahan>
+struct LaneState {
+    double s[kLanes];
+    double c[kLanes];
+    double pending[kLanes];
+    std::size_t npending;
+    NeumaierState merged;  // Totals of the states merged into this one.
+
+    LaneState() : npending(0) {
+        for (std::size_t l = 0; l < kLanes; ++l) {
+            s[l] = c[l] = pending[l] = 0.0;
+        }
+    }
+
+    void add(const double* x, std::size_t n) {
+        // Local copies let the compiler keep the lanes in registers: x
+        // cannot alias them.
+        double ls[kLanes], lc[kLanes];
+        for (std::size_t l = 0; l < kLanes; ++l) {
+            ls[l] = s[l];
+            lc[l] = c[l];
+        }
+        std::size_t i = 0;
+        if (npending > 0) {
+            while (npending < kLanes && i < n) {
+                pending[npending++] = x[i++];
+            }
+            if (npending < kLanes) {
+                return;
+            }
+            update(ls, lc, pending);
+            npending = 0;
+        }
+        for (; i + kLanes <= n; i += kLanes) {
+            update(ls, lc, x + i);
+        }
+        while (i < n) {
+            pending[npending++] = x[i++];
+        }
+        for (std::size_t l = 0; l < kLanes; ++l) {
+            s[l] = ls[l];
+            c[l] = lc[l];
+        }
+    }
+
+    void merge(const LaneState& other) { merged.merge(other.total()); }
+
+    double result() const { return total().result(); }
+
+    // Lanes merged with an exact two-sum, then the pending tail.
+    NeumaierState total() const {
+        NeumaierState t;
+        for (std::size_t l = 0; l < kLanes; ++l) {
+            NeumaierState lane;
+            lane.sum = s[l];
+            lane.c = Kahan ? -c[l] : c[l];  // Kahan keeps the negated error: the lane value is s - c.
+            t.merge(lane);
+        }
+        for (std::size_t i = 0; i < npending; ++i) {
+            t.add(pending[i]);
+        }
+        t.merge(merged);
+        return t;
+    }
+
+private:
+    static void update(double* ls, double* lc, const double* x) {
+        if (Kahan) {
+            kahan_lanes(ls, lc, x);
+        } else {
+            neumaier_lanes(ls, lc, x);
+        }
+    }
+};
+
+}  // namespace simd_sum
+
+// Kahan summation in kLanes independent lanes.
+class SimdKahanSummator : public Summator {
+public:
+    typedef simd_sum::LaneState<true> State;
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
+};
+
+// Neumaier summation in kLanes independent lanes.
+class SimdNeumaierSummator : public Summator {
+public:
+    typedef simd_sum::LaneState<false> State;
+
+    std::unique_ptr<Accumulator> accumulator() const override { return make_accumulator<State>(); }
+};
+
+#endif // SIMD_COMPENSATED_SUMMATOR_HPP
@@ -2,13 +2,72 @@
 #define SUMMATOR_HPP
 
 #include <vector>
+#include <memory>
+#include <cstddef>
+#include <stdexcept>
 
 // Abstract base class for a summation algorithm.
+//
+// A sum can be taken in one call, over a vector or any contiguous range
+// (a slice, an mmap'd file, a GSL buffer) without copying, or incrementally
+// through an Accumulator: blocks are added as they arrive, accumulators of
+// different parts of the data can be merged, and result() gives the total.
 class Summator {
 public:
+    // Running sum of blocks streamed one after another.
+    class Accumulator {
+    public:
+        virtual ~Accumulator() = default;
+        // Add the block x[0..n).
+        virtual void add(const double* x, std::size_t n) = 0;
+        void add(const std::vector<double>& block) { add(block.data(), block.size()); }
+        // Combine with an accumulator of the same summator covering other data.
+        // Throws std::invalid_argument if it comes from a different summator.
+        virtual void merge(const Accumulator& other) = 0;
+        // Sum of everything added and merged so far.
+        virtual double result() const = 0;
+    };
+
     virtual ~Summator() = default;
+
+    // New, empty accumulator for this algorithm.
+    virtual std::unique_ptr<Accumulator> accumulator() const = 0;
+
+    // Return the sum of x[0..n).
+    virtual double sum(const double* x, std::size_t n) const {
+        std::unique_ptr<Accumulator> acc = accumulator();
+        acc->add(x, n);
+        return acc->result();
+    }
+
     // Return the sum of the elements in vec.
-    virtual double sum(const std::vector<double>& vec) const = 0;
+    double sum(const std::vector<double>& vec) const { return sum(vec.data(), vec.size()); }
 };
 
+// Accumulator over a plain state type with add(const double*, size_t),
+// merge(const State&) and result(), which each summator defines as State.
+template <typename State>
+class StateAccumulator : public Summator::Accumulator {
+public:
+    void add(const double* x, std::size_t n) override { state.add(x, n); }
+
+    void merge(const Summator::Accumulator& other) override {
+        const StateAccumulator* o = dynamic_cast<const StateAccumulator*>(&other);
+        if (o == nullptr) {
+            throw std::invalid_argument("Cannot merge accumulators of different summators.");
+        }
+        state.merge(o->state);
+    }
+
+    double result() const override { return state.result(); }
+
+    State state;
+};
+
+// accumulator() of a summator whose running state is State.
+template <typename State>
+std::unique_ptr<Summator::Accumulator> make_accumulator() {
+    return std::unique_ptr<Summator::Accumulator>(new StateAccumulator<State>());
+}
+
 #endif // SUMMATOR_HPP
@@ -12,33 +12,22 @@
 
 #include "VectorGenerator.hpp"
 #include "VectorSumInterface.hpp"
+#include "VectorSumDefault.hpp"
+#include "VectorExpr.hpp"
+#include "DaxpySweep.hpp"
 
 /**
- * @brief Validates that the computed DAXPY result vector follows the expected Gaussian distribution.
- *
- * This function checks whether the result vector @p d, computed as d = a * x + y, conforms to
- * a Gaussian distribution with mean 0 and RMS (root mean square) equal to sqrt(a²+1).
- *
- * It calculates the sample mean and RMS from the vector and compares these to the theoretical values.
+ * @brief Checks a sample mean and RMS against the Gaussian N(0, a²+1) expected for d = a * x + y.
  *
- * @param d The result vector to be validated.
+ * @param mean The sample mean of d.
+ * @param sample_rms The sample RMS of d.
  * @param a The scalar multiplier used in the DAXPY computation.
  * @param tol_mean Tolerance allowed for the difference in means.
  * @param tol_rms Tolerance allowed for the difference in RMS values.
  * @return true if both the sample mean and RMS are within the tolerances; false otherwise.
  */
-bool validate_gaussian_daxpy_result(const std::vector<double>& d, double a,
-                                    double tol_mean, double tol_rms) {
-    std::size_t n = d.size();
-    
-    // Calculate the sample mean.
-    double sum = std::accumulate(d.begin(), d.end(), 0.0);
-    double mean = sum / n;
-    
-    // Calculate the sample RMS (root mean square).
-    double sq_sum = std::inner_product(d.begin(), d.end(), d.begin(), 0.0);
-    double sample_rms = std::sqrt(sq_sum / n);
-    
+bool validate_gaussian_daxpy_moments(double mean, double sample_rms, double a,
+                                     double tol_mean, double tol_rms) {
     // Theoretical values for a Gaussian distribution N(0, a²+1)
     double expected_mean = 0.0;
     double expected_rms = std::sqrt(a * a + 1.0);
@@ -57,6 +46,29 @@ bool validate_gaussian_daxpy_result(const std::vector<double>& d, double a,
     return mean_ok && rms_ok;
 }
 
+/**
+ * @brief Validates that the computed DAXPY result vector follows the expected Gaussian distribution.
+ *
+ * This function checks whether the result vector @p d, computed as d = a * x + y, conforms to
+ * a Gaussian distribution with mean 0 and RMS (root mean square) equal to sqrt(a²+1).
+ *
+ * It calculates the sample mean and RMS from the vector (both sums in one pass) and compares
+ * these to the theoretical values.
+ *
+ * @param d The result vector to be validated.
+ * @param a The scalar multiplier used in the DAXPY computation.
+ * @param tol_mean Tolerance allowed for the difference in means.
+ * @param tol_rms Tolerance allowed for the difference in RMS values.
+ * @return true if both the sample mean and RMS are within the tolerances; false otherwise.
+ */
+bool validate_gaussian_daxpy_result(const std::vector<double>& d, double a,
+                                    double tol_mean, double tol_rms) {
+    std::size_t n = d.size();
+    double sum = 0.0, sq_sum = 0.0;
+    vexpr::reduce(vexpr::ref(d), vexpr::sum(sum), vexpr::sum_squares(sq_sum));
+    return validate_gaussian_daxpy_moments(sum / n, std::sqrt(sq_sum / n), a, tol_mean, tol_rms);
+}
+
 /**
  * @brief Runs the DAXPY test using the provided vector summation implementation.
  *
@@ -93,7 +105,9 @@ void run_vector_sum_test(std::size_t n, double a, int n_iter,
     // Generate input vectors x and y with Gaussian random values.
     std::vector<double> x = VectorGenerator::generate_gaussian_vector(n);
     std::vector<double> y = VectorGenerator::generate_gaussian_vector(n);
-    std::vector<double> d;  // This vector will hold the computed result d = a * x + y.
+    // This vector will hold the computed result d = a * x + y. It is aligned and not
+    // zero-filled on resize, so the first iteration also times the first touch of d.
+    AlignedVector<double> d;
     
     // Vectors to store the execution times and errors for each iteration.
     std::vector<double> times;
@@ -112,10 +126,10 @@ void run_vector_sum_test(std::size_t n, double a, int n_iter,
         std::chrono::duration<double> elapsed = end - start;
         times.push_back(elapsed.count());
         
-        // Compute sample mean.
-        double computed_mean = std::accumulate(d.begin(), d.end(), 0.0) / n;
-        // Compute sample RMS.
-        double computed_sq_sum = std::inner_product(d.begin(), d.end(), d.begin(), 0.0);
+        // Sample mean and RMS: sum and sum of squares of d in a single pass.
+        double computed_sum = 0.0, computed_sq_sum = 0.0;
+        vexpr::reduce(vexpr::ref(d), vexpr::sum(computed_sum), vexpr::sum_squares(computed_sq_sum));
+        double computed_mean = computed_sum / n;
         double computed_rms = std::sqrt(computed_sq_sum / n);
         
         // Compute absolute errors for mean and RMS.
@@ -125,9 +139,14 @@ void run_vector_sum_test(std::size_t n, double a, int n_iter,
         sum_error_rms  += error_rms;
         
         // Validate that the resulting vector d has the expected Gaussian properties.
-        bool valid = validate_gaussian_daxpy_result(d, a, tol_mean, tol_rms);
+        bool valid = validate_gaussian_daxpy_moments(computed_mean, computed_rms, a, tol_mean, tol_rms);
         assert(valid && "DAXPY result does not match the expected Gaussian distribution!");
     }
+
+    // The in-place update y = a * x + y must give the same vector.
+    std::vector<double> y_inplace(y);
+    summator.compute_sum_inplace(x, a, y_inplace);
+    assert(std::equal(d.begin(), d.end(), y_inplace.begin()) && "In-place DAXPY result differs from d = a * x + y!");
     
     // Calculate performance statistics: average time, RMS time, minimum, and maximum times.
     double total_time = std::accumulate(times.begin(), times.end(), 0.0);
@@ -161,4 +180,133 @@ void run_vector_sum_test(std::size_t n, double a, int n_iter,
     std::cout << "------------------------------------------------------" << std::endl << std::endl;
 }
 
+/**
+ * @brief Times DAXPY followed by the mean and RMS of d: three separate passes
+ *        (VectorSumDefault, std::accumulate, std::inner_product) versus one fused
+ *        pass with the expression templates of VectorExpr.hpp.
+ *
+ * Both variants must produce the same d, and the fused moments are validated like
+ * in run_vector_sum_test().
+ */
+void run_fused_daxpy_test(std::size_t n, double a, int n_iter) {
+    const double sigma = std::sqrt(a * a + 1.0);
+    const double tol_factor = 3.2;
+    double tol_mean = tol_factor * sigma / std::sqrt(n);
+    double tol_rms  = tol_factor * sigma / std::sqrt(n*2);
+
+    std::vector<double> x = VectorGenerator::generate_gaussian_vector(n);
+    std::vector<double> y = VectorGenerator::generate_gaussian_vector(n);
+    std::vector<double> d_separate;
+    AlignedVector<double> d_fused;
+    VectorSumDefault daxpy;
+
+    double time_separate = 0.0, time_fused = 0.0;
+    double mean = 0.0, rms = 0.0, mean_separate = 0.0, rms_separate = 0.0;
+    for (int iter = 0; iter < n_iter; ++iter) {
+        auto start = std::chrono::high_resolution_clock::now();
+        daxpy.compute_sum(x, y, a, d_separate);
+        double sum_separate = std::accumulate(d_separate.begin(), d_separate.end(), 0.0);
+        double sq_sum_separate = std::inner_product(d_separate.begin(), d_separate.end(), d_separate.begin(), 0.0);
+        auto mid = std::chrono::high_resolution_clock::now();
+        double sum = 0.0, sq_sum = 0.0;
+        vexpr::assign(d_fused, a * vexpr::ref(x) + vexpr::ref(y), vexpr::sum(sum), vexpr::sum_squares(sq_sum));
+        auto end = std::chrono::high_resolution_clock::now();
+
+        time_separate += std::chrono::duration<double>(mid - start).count();
+        time_fused += std::chrono::duration<double>(end - mid).count();
+        assert(std::equal(d_fused.begin(), d_fused.end(), d_separate.begin()) &&
+               "Fused DAXPY result differs from the default implementation!");
+
+        mean = sum / n;
+        rms = std::sqrt(sq_sum / n);
+        mean_separate = sum_separate / n;
+        rms_separate = std::sqrt(sq_sum_separate / n);
+        bool valid = validate_gaussian_daxpy_moments(mean, rms, a, tol_mean, tol_rms);
+        assert(valid && "Fused DAXPY moments do not match the expected Gaussian distribution!");
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "Fused DAXPY + mean/RMS Test:" << std::endl;
+    std::cout << "Vector size (n): " << n << ", Scalar (a): " << a
+              << ", Iterations: " << n_iter << std::endl;
+    std::cout << "Fused:    sample mean = " << mean << ", sample RMS = " << rms << std::endl;
+    std::cout << "Separate: sample mean = " << mean_separate << ", sample RMS = " << rms_separate << std::endl;
+    std::cout << "  Average time, separate passes: " << time_separate / n_iter << " seconds" << std::endl;
+    std::cout << "  Average time, fused pass:      " << time_fused / n_iter << " seconds" << std::endl;
+    std::cout << "Test passed successfully." << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl << std::endl;
+}
+
+/**
+ * @brief Times a parameter scan d_k = a_k * x + y over n_scalars values a_k in [-a, a].
+ *
+ * Three variants are compared: one VectorSumInterface::compute_sum() call per scalar,
+ * the batched compute_sums() of @p summator, and daxpy_sweep_moments(), which only
+ * returns the per-scalar sum and sum of squares. The batched outputs must equal the
+ * per-scalar ones, and the moments of every d_k are validated against N(0, a_k²+1).
+ * The batched outputs take n_scalars·n doubles; the per-scalar calls reuse one buffer.
+ */
+void run_daxpy_sweep_test(std::size_t n, double a, std::size_t n_scalars, int n_iter,
+                          VectorSumInterface& summator) {
+    std::vector<double> scalars(n_scalars);
+    for (std::size_t k = 0; k < n_scalars; ++k) {
+        scalars[k] = n_scalars > 1 ? -a + 2.0 * a * double(k) / double(n_scalars - 1) : a;
+    }
+
+    std::vector<double> x = VectorGenerator::generate_gaussian_vector(n);
+    std::vector<double> y = VectorGenerator::generate_gaussian_vector(n);
+    // One reused per-scalar output: only compute_sums() holds all K outputs.
+    std::vector<double> d_single;
+    std::vector<std::vector<double>> d_batched;
+    SweepMoments moments;
+
+    // The first calls allocate the outputs; keep those page faults out of the timings.
+    summator.compute_sum(x, y, scalars[0], d_single);
+    summator.compute_sums(x, y, scalars, d_batched);
+
+    double time_single = 0.0, time_batched = 0.0, time_moments = 0.0;
+    for (int iter = 0; iter < n_iter; ++iter) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (std::size_t k = 0; k < n_scalars; ++k) {
+            summator.compute_sum(x, y, scalars[k], d_single);
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        summator.compute_sums(x, y, scalars, d_batched);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        moments = daxpy_sweep_moments(scalars, x, y);
+        auto t3 = std::chrono::high_resolution_clock::now();
+
+        time_single += std::chrono::duration<double>(t1 - t0).count();
+        time_batched += std::chrono::duration<double>(t2 - t1).count();
+        time_moments += std::chrono::duration<double>(t3 - t2).count();
+    }
+
+    // Compare the batched outputs with the per-scalar calls one d_k at a time.
+    for (std::size_t k = 0; k < n_scalars; ++k) {
+        summator.compute_sum(x, y, scalars[k], d_single);
+        assert(d_batched[k] == d_single && "Batched DAXPY result differs from the per-scalar calls!");
+    }
+
+    for (std::size_t k = 0; k < n_scalars; ++k) {
+        const double sigma = std::sqrt(scalars[k] * scalars[k] + 1.0);
+        // 2·n_scalars checks per run: 4.5 sigma keeps the false-failure rate below 0.1%.
+        const double tol_factor = 4.5;
+        double tol_mean = tol_factor * sigma / std::sqrt(n);
+        double tol_rms  = tol_factor * sigma / std::sqrt(n*2);
+        bool valid = validate_gaussian_daxpy_moments(moments.sum[k] / n, std::sqrt(moments.sum_squares[k] / n),
+                                                     scalars[k], tol_mean, tol_rms);
+        assert(valid && "Sweep moments do not match the expected Gaussian distribution!");
+    }
+
+    std::cout << "------------------------------------------------------" << std::endl;
+    std::cout << "DAXPY Sweep Test:" << std::endl;
+    std::cout << "Vector size (n): " << n << ", Scalars: " << n_scalars << " in [" << -a << ", " << a
+              << "], Iterations: " << n_iter << std::endl;
+    std::cout << "  Average time, one call per scalar: " << time_single / n_iter << " seconds" << std::endl;
+    std::cout << "  Average time, compute_sums():      " << time_batched / n_iter << " seconds" << std::endl;
+    std::cout << "  Average time, sweep moments only:  " << time_moments / n_iter << " seconds" << std::endl;
+    std::cout << "Test passed successfully." << std::endl;
+    std::cout << "------------------------------------------------------" << std::endl << std::endl;
+}
+
 #endif // TEST_SUITE_HPP
\ No newline at end of file
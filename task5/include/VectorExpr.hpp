@@ -0,0 +1,223 @@
+#ifndef VECTOR_EXPR_HPP
+#define VECTOR_EXPR_HPP
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * @brief Expression templates for fused vector kernels.
+ *
+ * Writing `a * ref(x) + ref(y)` builds a small expression object instead of a
+ * temporary vector: element i is computed on demand as a * x[i] + y[i].
+ * assign() stores an expression into d and, in the same pass, feeds every
+ * stored value to any number of reductions:
+ *
+ * @code
+ *     double s, ss;
+ *     vexpr::assign(d, a * vexpr::ref(x) + vexpr::ref(y),
+ *                   vexpr::sum(s), vexpr::sum_squares(ss));   // s = Σ d, ss = dot(d, d)
+ *     vexpr::reduce(vexpr::ref(d), vexpr::sum(s));              // reductions only, no store
+ * @endcode
+ *
+ * The pass is cut into blocks of kBlock elements shared among OpenMP threads.
+ * In each block the expression is evaluated in one vectorizable loop, and the
+ * reductions then run over the block while it is still in L1 cache. Each of
+ * them uses an `omp simd` reduction, so the additions are split over vector
+ * lanes. So x, y and d are streamed from memory once, whatever the number of
+ * reductions. Block partial sums are combined in block order, so the results
+ * do not depend on the number of threads.
+ *
+ * Expressions keep references to the vectors they read: build and evaluate
+ * them in the same statement, as above. d may be one of the operands
+ * (d = a*d + y), but the expression given to dot() must not read d.
+ */
+namespace vexpr {
+
+// Elements per block: x, y and d blocks together take 24 KiB.
+const std::size_t kBlock = 1024;
+
+// CRTP base of all expressions.
+template <typename E>
+struct Expr {
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+// Leaf: a contiguous range of doubles.
+struct Ref : Expr<Ref> {
+    const double* p;
+    std::size_t n;
+
+    Ref(const double* data, std::size_t size) : p(data), n(size) {}
+    double operator[](std::size_t i) const { return p[i]; }
+    std::size_t size() const { return n; }
+};
+
+template <typename Alloc>
+Ref ref(const std::vector<double, Alloc>& v) { return Ref(v.data(), v.size()); }
+inline Ref ref(const double* data, std::size_t n) { return Ref(data, n); }
+
+// a * e
+template <typename E>
+struct Scaled : Expr<Scaled<E> > {
+    double a;
+    E e;
+
+    Scaled(double scale, const E& expr) : a(scale), e(expr) {}
+    double operator[](std::size_t i) const { return a * e[i]; }
+    std::size_t size() const { return e.size(); }
+};
+
+// l + sign * r, sign = ±1
+template <typename L, typename R, int Sign>
+struct Binary : Expr<Binary<L, R, Sign> > {
+    L l;
+    R r;
+
+    Binary(const L& left, const R& right) : l(left), r(right) {
+        if (l.size() != r.size()) {
+            throw std::invalid_argument("Vector expression operands must have the same size.");
+        }
+    }
+    double operator[](std::size_t i) const { return Sign > 0 ? l[i] + r[i] : l[i] - r[i]; }
+    std::size_t size() const { return l.size(); }
+};
+
+template <typename E>
+Scaled<E> operator*(double a, const Expr<E>& e) { return Scaled<E>(a, e.self()); }
+template <typename E>
+Scaled<E> operator*(const Expr<E>& e, double a) { return Scaled<E>(a, e.self()); }
+template <typename L, typename R>
+Binary<L, R, 1> operator+(const Expr<L>& l, const Expr<R>& r) { return Binary<L, R, 1>(l.self(), r.self()); }
+template <typename L, typename R>
+Binary<L, R, -1> operator-(const Expr<L>& l, const Expr<R>& r) { return Binary<L, R, -1>(l.self(), r.self()); }
+
+// ————————————————————————————————————————————————————————————————
+// Reductions over the evaluated values v[0..m) of block [i0, i0 + m)
+// ————————————————————————————————————————————————————————————————
+
+// out = Σ v_i
+struct Sum {
+    double* out;
+
+    double block(const double* v, std::size_t, std::size_t m) const {
+        double s = 0.0;
+        #pragma omp simd reduction(+:s)
+        for (std::size_t j = 0; j < m; ++j) {
+            s += v[j];
+        }
+        return s;
+    }
+};
+
+// out = Σ v_i², i.e. dot(d, d)
+struct SumSquares {
+    double* out;
+
+    double block(const double* v, std::size_t, std::size_t m) const {
+        double s = 0.0;
+        #pragma omp simd reduction(+:s)
+        for (std::size_t j = 0; j < m; ++j) {
+            s += v[j] * v[j];
+        }
+        return s;
+    }
+};
+
+// out = Σ v_i · e_i
+template <typename E>
+struct Dot {
+    E e;
+    double* out;
+
+    double block(const double* v, std::size_t i0, std::size_t m) const {
+        double s = 0.0;
+        #pragma omp simd reduction(+:s)
+        for (std::size_t j = 0; j < m; ++j) {
+            s += v[j] * e[i0 + j];
+        }
+        return s;
+    }
+};
+
+inline Sum sum(double& out) { return Sum{&out}; }
+inline SumSquares sum_squares(double& out) { return SumSquares{&out}; }
+template <typename E>
+Dot<E> dot(const Expr<E>& e, double& out) { return Dot<E>{e.self(), &out}; }
+
+namespace detail {
+
+// Block partials of reductions r..., in argument order, into part[0..).
+inline void block_reductions(double*, const double*, std::size_t, std::size_t) {}
+
+template <typename R, typename... Rest>
+void block_reductions(double* part, const double* v, std::size_t i0, std::size_t m,
+                      const R& r, const Rest&... rest) {
+    part[0] = r.block(v, i0, m);
+    block_reductions(part + 1, v, i0, m, rest...);
+}
+
+inline void store_results(const double*) {}
+
+template <typename R, typename... Rest>
+void store_results(const double* total, const R& r, const Rest&... rest) {
+    *r.out = total[0];
+    store_results(total + 1, rest...);
+}
+
+// One blocked pass: d[i] = e[i] (if d is not null) and all reductions.
+template <typename E, typename... R>
+void evaluate(double* d, const E& e, const R&... reds) {
+    const std::size_t n = e.size();
+    const std::size_t nred = sizeof...(R);
+    const long long blocks = static_cast<long long>((n + kBlock - 1) / kBlock);
+    std::vector<double> partial(static_cast<std::size_t>(blocks) * nred);
+
+    #pragma omp parallel for schedule(static) if(blocks > 16)
+    for (long long b = 0; b < blocks; ++b) {
+        const std::size_t i0 = static_cast<std::size_t>(b) * kBlock;
+        const std::size_t m = (i0 + kBlock < n) ? kBlock : n - i0;
+        double buffer[kBlock];
+        double* v = d ? d + i0 : buffer;
+        for (std::size_t j = 0; j < m; ++j) {
+            v[j] = e[i0 + j];
+        }
+        block_reductions(partial.data() + static_cast<std::size_t>(b) * nred, v, i0, m, reds...);
+    }
+
+    std::vector<double> total(nred, 0.0);
+    for (long long b = 0; b < blocks; ++b) {
+        for (std::size_t k = 0; k < nred; ++k) {
+            total[k] += partial[static_cast<std::size_t>(b) * nred + k];
+        }
+    }
+    store_results(total.data(), reds...);
+}
+
+}  // namespace detail
+
+/**
+ * @brief d = e, with the reductions taken over the stored values in the same pass.
+ * d is resized to e.size() (without zero-filling if d is an AlignedVector).
+ */
+template <typename Alloc, typename E, typename... R>
+void assign(std::vector<double, Alloc>& d, const Expr<E>& e, const R&... reds) {
+    d.resize(e.self().size());
+    detail::evaluate(d.data(), e.self(), reds...);
+}
+
+/// d[0..e.size()) = e for a caller-provided buffer, with reductions.
+template <typename E, typename... R>
+void assign(double* d, const Expr<E>& e, const R&... reds) {
+    detail::evaluate(d, e.self(), reds...);
+}
+
+/// Reductions of e without storing it anywhere.
+template <typename E, typename... R>
+void reduce(const Expr<E>& e, const R&... reds) {
+    detail::evaluate(static_cast<double*>(nullptr), e.self(), reds...);
+}
+
+}  // namespace vexpr
+
+#endif // VECTOR_EXPR_HPP
@@ -4,6 +4,11 @@
 #include <vector>
 #include <random>
 #include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include "CounterRNG.hpp"
+#include "NeumaierSummator.hpp"
 
 /**
  * @brief Utility class for generating vectors filled with random numbers.
@@ -12,6 +17,10 @@
  * random distributions. In particular, the generate_gaussian_vector() method creates a vector
  * with elements sampled from a Gaussian (normal) distribution with a mean of 0 and a standard deviation of 1.
  *
+ * The values come from the counter-based generator in CounterRNG.hpp: element i depends only on
+ * the seed and on i, so a given seed always produces the same vector, and fill_gaussian() can
+ * produce any slice of it (per thread or per MPI rank) without generating the elements before it.
+ *
  * Example usage:
  * @code
  *     std::vector<double> my_vector = VectorGenerator::generate_gaussian_vector(100);
@@ -23,25 +32,94 @@ public:
      * @brief Generates a vector of Gaussian random numbers.
      *
      * This function returns a vector of size @p N, where each element is randomly generated
-     * from a normal distribution with mean 0 and standard deviation 1.
+     * from a normal distribution with mean 0 and standard deviation 1. A fresh seed is drawn
+     * from std::random_device on every call, so successive vectors are independent.
      *
      * @param N The number of elements to generate.
      * @return std::vector<double> A vector of size @p N with Gaussian-distributed values.
      */
     static std::vector<double> generate_gaussian_vector(std::size_t N) {
+        return generate_gaussian_vector(N, random_seed());
+    }
+
+    /**
+     * @brief Generates the first @p N elements of the Gaussian sequence for @p seed.
+     *
+     * The result is bitwise reproducible for a given seed, independent of the number of threads.
+     */
+    static std::vector<double> generate_gaussian_vector(std::size_t N, std::uint64_t seed) {
         std::vector<double> vec(N);
-        // Seed the random number generator using a random device.
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        // Define the normal distribution with mean 0.0 and standard deviation 1.0.
-        std::normal_distribution<double> dist(0.0, 1.0);
-        
-        // Fill the vector with random numbers sampled from the Gaussian distribution.
-        for (std::size_t i = 0; i < N; ++i) {
-            vec[i] = dist(gen);
+        fill_gaussian(vec.data(), 0, N, seed);
+        return vec;
+    }
+
+    /**
+     * @brief Writes elements [begin, end) of the Gaussian sequence for @p seed to @p out.
+     *
+     * Filling the ranges of a partition separately (e.g. one per MPI rank) gives exactly the
+     * values generate_gaussian_vector(end, seed) has at those indices.
+     */
+    static void fill_gaussian(double* out, std::uint64_t begin, std::uint64_t end, std::uint64_t seed) {
+        CounterRNG::fill_gaussian(out, begin, end, seed);
+    }
+
+    /**
+     * @brief Generates @p N summands whose sum has condition number about @p cond.
+     *
+     * The condition number of a sum is Σ|x_i| / |Σ x_i|; a summator with unit roundoff u
+     * has a relative error of up to about n·u·cond (cond·u for compensated ones). The
+     * construction follows the GenSum/GenDot generators of Ogita, Rump and Oishi:
+     *   1) the first half are u·2^e with u uniform in [-1, 1] and e uniform in [0, b],
+     *      b = log2(cond)/2 (the first one has e = b), so magnitudes span 2^b;
+     *   2) the second half are u·2^e - S, with e falling linearly from b to 0 and S
+     *      the running sum of the previous elements (kept as a Neumaier sum), so the
+     *      partial sums cancel down to O(1);
+     *   3) the last element sets the sum to Σ|x_i| / cond;
+     *   4) the elements are shuffled.
+     * For cond <= 1 the elements are uniform in (0, 1], so the condition number is 1.
+     * The result depends only on N, cond and seed.
+     */
+    static std::vector<double> generate_ill_conditioned_vector(std::size_t N, double cond, std::uint64_t seed) {
+        std::vector<double> vec(N);
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        if (cond <= 1.0 || N < 2) {
+            for (std::size_t i = 0; i < N; ++i) {
+                vec[i] = 1.0 - unit(rng);
+            }
+            return vec;
         }
+
+        const double b = std::min(0.5 * std::log2(cond), 500.0);
+        const std::size_t half = N / 2;
+        NeumaierState partial;  // Σ x_i so far
+        NeumaierState magnitude;  // Σ |x_i| so far
+        for (std::size_t i = 0; i < half; ++i) {
+            const double e = (i == 0) ? b : std::floor(unit(rng) * (b + 1.0));
+            vec[i] = (2.0 * unit(rng) - 1.0) * std::ldexp(1.0, static_cast<int>(std::min(e, b)));
+            partial.add(vec[i]);
+            magnitude.add(std::fabs(vec[i]));
+        }
+        for (std::size_t i = half; i + 1 < N; ++i) {
+            const double e = std::round(b * double(N - 2 - i) / double(N - 1 - half));
+            vec[i] = (2.0 * unit(rng) - 1.0) * std::ldexp(1.0, static_cast<int>(e)) - partial.result();
+            partial.add(vec[i]);
+            magnitude.add(std::fabs(vec[i]));
+        }
+        // Last element: Σ x = Σ|x| / cond, where Σ|x| includes the last element itself.
+        double last = magnitude.result() / cond - partial.result();
+        last = (magnitude.result() + std::fabs(last)) / cond - partial.result();
+        vec[N - 1] = last;
+
+        std::shuffle(vec.begin(), vec.end(), rng);
         return vec;
     }
+
+    /// A 64-bit seed from std::random_device.
+    static std::uint64_t random_seed() {
+        static std::random_device rd;
+        return (std::uint64_t(rd()) << 32) ^ rd();
+    }
 };
 
 #endif // VECTOR_GENERATOR_HPP
@@ -11,17 +11,17 @@
  *
  *     d[i] = a * x[i] + y[i]
  *
+ * Pass an AlignedVector<double> as d to skip the zero-fill of d.resize().
  */
 class VectorSumDefault : public VectorSumInterface {
 public:
-    virtual void compute_sum(const std::vector<double>& x,
-                             const std::vector<double>& y,
+    using VectorSumInterface::compute_sum;
+
+    virtual void compute_sum(const double* x,
+                             const double* y,
                              double a,
-                             std::vector<double>& d) override {
-        // Determine the number of elements.
-        size_t N = x.size();
-        // Resize the output vector to match.
-        d.resize(N);
+                             double* d,
+                             std::size_t N) override {
         // Compute each element of d.
         for (size_t i = 0; i < N; ++i) {
             d[i] = a * x[i] + y[i];
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <cstddef>
+#include <stdexcept>
+#include "AlignedAllocator.hpp"
 
 /**
  * @brief Abstract interface for computing the vector sum.
@@ -16,14 +18,72 @@
  * It allows the rest of the application to work with a single, unified interface regardless
  *   of the underlying implementation (e.g., default or GSL-based).
  * It provides flexibility to easily extend or switch implementations at runtime.
+ *
+ * Implementations provide the raw pointer/length form, which works on any contiguous
+ * buffer (pre-allocated arrays, mmap'd files, slices) without allocating; d may be the
+ * same buffer as y. The std::vector form and the in-place update y = a * x + y
+ * (compute_sum_inplace) are built on it.
  */
 class VectorSumInterface {
 public:
     virtual ~VectorSumInterface() {}
-    virtual void compute_sum(const std::vector<double>& x,
-                             const std::vector<double>& y,
+
+    /// d[i] = a * x[i] + y[i] for i < n; d may equal y (other overlaps are not supported).
+    virtual void compute_sum(const double* x,
+                             const double* y,
                              double a,
-                             std::vector<double>& d) = 0;
+                             double* d,
+                             std::size_t n) = 0;
+
+    /**
+     * d = a * x + y; d is resized to x.size(). Throws std::invalid_argument on a size mismatch.
+     * With an AlignedVector<double> output the resize does not zero-fill d, so the kernel
+     * performs the first write to it.
+     */
+    template <typename Alloc>
+    void compute_sum(const std::vector<double>& x,
+                     const std::vector<double>& y,
+                     double a,
+                     std::vector<double, Alloc>& d) {
+        check_sizes(x, y);
+        d.resize(x.size());
+        compute_sum(x.data(), y.data(), a, d.data(), x.size());
+    }
+
+    /// y = a * x + y, without a third array. Throws std::invalid_argument on a size mismatch.
+    void compute_sum_inplace(const std::vector<double>& x, double a, std::vector<double>& y) {
+        check_sizes(x, y);
+        compute_sum(x.data(), y.data(), a, y.data(), x.size());
+    }
+
+    /// y[i] = a * x[i] + y[i] for i < n.
+    void compute_sum_inplace(const double* x, double a, double* y, std::size_t n) {
+        compute_sum(x, y, a, y, n);
+    }
+
+    /**
+     * @brief Batched DAXPY over a list of scalars: d[k] = a[k] * x + y.
+     *
+     * The default calls compute_sum() once per scalar. Writing all a.size() outputs
+     * is bound by the output traffic; a scan that only needs sums of the outputs
+     * should use daxpy_sweep_moments() (DaxpySweep.hpp), which stores none of them.
+     */
+    virtual void compute_sums(const std::vector<double>& x,
+                              const std::vector<double>& y,
+                              const std::vector<double>& a,
+                              std::vector<std::vector<double>>& d) {
+        d.resize(a.size());
+        for (std::size_t k = 0; k < a.size(); ++k) {
+            compute_sum(x, y, a[k], d[k]);
+        }
+    }
+
+protected:
+    static void check_sizes(const std::vector<double>& x, const std::vector<double>& y) {
+        if (x.size() != y.size()) {
+            throw std::invalid_argument("Vectors x and y must have the same size.");
+        }
+    }
 };
 
 #endif // VECTOR_SUM_INTERFACE_HPP
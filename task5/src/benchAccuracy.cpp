@@ -0,0 +1,168 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <stdexcept>
+
+#include "VectorGenerator.hpp"
+#include "ForLoopSummator.hpp"
+#include "GSLSummator.hpp"
+#include "PairwiseSummator.hpp"
+#include "KahanSummator.hpp"
+#include "NeumaierSummator.hpp"
+#include "ParallelNeumaierSummator.hpp"
+#include "SimdCompensatedSummator.hpp"
+#include "ExactSummator.hpp"
+
+// One measurement of a summator on one input.
+struct Row {
+    std::size_t n;
+    double cond_target;
+    double cond;
+    std::string summator;
+    double sum;
+    double rel_error;
+    double ns_per_element;
+    double gb_per_s;
+};
+
+/**
+ * @brief Seconds per call: best of three timings, each over enough calls to
+ *        sum about 10^7 elements.
+ */
+double time_summator(const Summator& summator, const std::vector<double>& vec, double& result) {
+    const std::size_t calls = std::max<std::size_t>(1, 10000000 / std::max<std::size_t>(vec.size(), 1));
+    volatile double sink = 0.0;
+    double best = 1e300;
+    for (int trial = 0; trial < 3; ++trial) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (std::size_t c = 0; c < calls; ++c) {
+            result = summator.sum(vec);
+            sink = sink + result;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double>(end - start).count() / double(calls));
+    }
+    return best;
+}
+
+// Exact Σ|x_i| / |Σ x_i|.
+double condition_number(const std::vector<double>& vec, double exact_sum) {
+    SuperAccumulator magnitude;
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        magnitude.add(std::fabs(vec[i]));
+    }
+    return magnitude.result() / std::fabs(exact_sum);
+}
+
+void print_csv(const std::vector<Row>& rows) {
+    std::printf("n,cond_target,cond,summator,sum,rel_error,ns_per_element,gb_per_s\n");
+    for (const Row& r : rows) {
+        std::printf("%zu,%.3g,%.6e,%s,%.17g,%.6e,%.6g,%.6g\n", r.n, r.cond_target, r.cond,
+                    r.summator.c_str(), r.sum, r.rel_error, r.ns_per_element, r.gb_per_s);
+    }
+}
+
+void print_json(const std::vector<Row>& rows) {
+    std::printf("[\n");
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const Row& r = rows[i];
+        std::printf("  {\"n\": %zu, \"cond_target\": %.3g, \"cond\": %.6e, \"summator\": \"%s\", "
+                    "\"sum\": %.17g, \"rel_error\": %.6e, \"ns_per_element\": %.6g, \"gb_per_s\": %.6g}%s\n",
+                    r.n, r.cond_target, r.cond, r.summator.c_str(), r.sum, r.rel_error,
+                    r.ns_per_element, r.gb_per_s, i + 1 < rows.size() ? "," : "");
+    }
+    std::printf("]\n");
+}
+
+/**
+ * @brief Accuracy versus throughput of every summator on ill-conditioned sums.
+ *
+ * For n = 10^3, 10^4, ... up to max_n and condition numbers 1 to 10^32, an input is
+ * generated with VectorGenerator::generate_ill_conditioned_vector and summed by each
+ * summator. The relative error is measured against the correctly rounded sum from
+ * ExactSummator, and the condition number column is the exact one of the generated
+ * data. The table goes to stdout, progress to stderr.
+ *
+ * Command-line arguments:
+ *   argv[1] - Largest vector size (max_n), default 10^7, at most 10^9
+ *   argv[2] - Output format, "csv" (default) or "json"
+ */
+int main(int argc, char** argv) {
+    try {
+        std::size_t max_n = 10000000;
+        std::string format = "csv";
+        if (argc >= 2) {
+            max_n = static_cast<std::size_t>(std::stod(argv[1]));
+        }
+        if (argc >= 3) {
+            format = argv[2];
+        }
+        if (format != "csv" && format != "json") {
+            throw std::invalid_argument("Unknown format '" + format + "', expected csv or json.");
+        }
+        if (max_n < 1000 || max_n > 1000000000) {
+            throw std::invalid_argument("max_n must be between 10^3 and 10^9.");
+        }
+
+        ForLoopSummator forLoopSum;
+        GSLSummator gslSum;
+        PairwiseSummator pairwiseSum;
+        KahanSummator kahanSum;
+        NeumaierSummator neumaierSum;
+        ParallelNeumaierSummator parallelSum;
+        SimdKahanSummator simdKahanSum;
+        SimdNeumaierSummator simdNeumaierSum;
+        ExactSummator exactSum;
+
+        const std::vector<std::pair<std::string, const Summator*>> summators = {
+            {"ForLoop", &forLoopSum},
+            {"GSL", &gslSum},
+            {"Pairwise", &pairwiseSum},
+            {"Kahan", &kahanSum},
+            {"Neumaier", &neumaierSum},
+            {"ParallelNeumaier", &parallelSum},
+            {"SimdKahan", &simdKahanSum},
+            {"SimdNeumaier", &simdNeumaierSum},
+            {"Exact", &exactSum},
+        };
+        const double conds[] = {1.0, 1e4, 1e8, 1e16, 1e24, 1e32};
+
+        std::vector<Row> rows;
+        for (std::size_t n = 1000; n <= max_n; n *= 10) {
+            for (double cond_target : conds) {
+                std::cerr << "n = " << n << ", cond = " << cond_target << std::endl;
+                const std::vector<double> vec = VectorGenerator::generate_ill_conditioned_vector(n, cond_target, 2024);
+                const double exact = exactSum.sum(vec);
+                const double cond = condition_number(vec, exact);
+                for (const auto& entry : summators) {
+                    double s = 0.0;
+                    const double t = time_summator(*entry.second, vec, s);
+                    Row r;
+                    r.n = n;
+                    r.cond_target = cond_target;
+                    r.cond = cond;
+                    r.summator = entry.first;
+                    r.sum = s;
+                    r.rel_error = std::fabs(s - exact) / std::fabs(exact);
+                    r.ns_per_element = t / double(n) * 1e9;
+                    r.gb_per_s = double(n) * sizeof(double) / t * 1e-9;
+                    rows.push_back(r);
+                }
+            }
+        }
+
+        if (format == "json") {
+            print_json(rows);
+        } else {
+            print_csv(rows);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "X Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+#include "VectorGenerator.hpp"
+#include "ForLoopSummator.hpp"
+#include "NeumaierSummator.hpp"
+#include "ParallelNeumaierSummator.hpp"
+#include "KahanSummator.hpp"
+#include "SimdCompensatedSummator.hpp"
+#include "ExactSummator.hpp"
+
+/**
+ * @brief Times a summator: best of n_iter runs, in seconds.
+ */
+double time_summator(const Summator& summator, const std::vector<double>& vec, int n_iter, double& result) {
+    double best = 1e300;
+    for (int iter = 0; iter < n_iter; ++iter) {
+        auto start = std::chrono::high_resolution_clock::now();
+        result = summator.sum(vec);
+        auto end = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double>(end - start).count());
+    }
+    return best;
+}
+
+/**
+ * @brief Compares the compensated summators (sequential, SIMD multi-lane and parallel)
+ *        with the plain for loop.
+ *
+ * Command-line arguments:
+ *   argv[1] - Vector size (n), default 2^26
+ *   argv[2] - Number of timed iterations (n_iter), default 10
+ */
+int main(int argc, char** argv) {
+    std::size_t n = std::size_t(1) << 26;
+    int n_iter = 10;
+    if (argc >= 3) {
+        n = std::stoul(argv[1]);
+        n_iter = std::stoi(argv[2]);
+    }
+
+    // Mean 1: the sum grows with n, so the naive loop loses low-order bits.
+    std::vector<double> vec = VectorGenerator::generate_gaussian_vector(n, 2024);
+    for (std::size_t i = 0; i < n; ++i) {
+        vec[i] += 1.0;
+    }
+
+    ForLoopSummator forLoopSum;
+    KahanSummator kahanSum;
+    NeumaierSummator neumaierSum;
+    ParallelNeumaierSummator parallelSum;
+    SimdKahanSummator simdKahanSum;
+    SimdNeumaierSummator simdNeumaierSum;
+    ExactSummator exactSum;
+
+    const std::vector<std::pair<std::string, const Summator*>> summators = {
+        {"For loop", &forLoopSum},
+        {"Kahan", &kahanSum},
+        {"SIMD Kahan", &simdKahanSum},
+        {"SIMD Neumaier", &simdNeumaierSum},
+        {"Parallel Neumaier", &parallelSum},
+        {"Exact", &exactSum},
+    };
+
+    double ref = 0.0;
+    double s = 0.0;
+    std::cout << "Summing n = " << n << " elements (best of " << n_iter << " runs)\n\n";
+    std::cout << std::left << std::setw(20) << "Summator" << std::setw(14) << "Time [s]"
+              << std::setw(14) << "GB/s" << "Difference wrt Neumaier\n";
+
+    const double bytes = double(n) * sizeof(double);
+    double t = time_summator(neumaierSum, vec, n_iter, ref);
+    std::cout << std::setw(20) << "Neumaier" << std::setw(14) << t << std::setw(14) << bytes / t * 1e-9 << 0.0 << "\n";
+    for (const auto& entry : summators) {
+        t = time_summator(*entry.second, vec, n_iter, s);
+        std::cout << std::setw(20) << entry.first << std::setw(14) << t << std::setw(14) << bytes / t * 1e-9 << s - ref << "\n";
+    }
+
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include "PairwiseSummator.hpp"
 #include "KahanSummator.hpp"
 #include "NeumaierSummator.hpp"
+#include "ExactSummator.hpp"
 
 
 // Define the vector: [1.0, 1.0e16, -1.0e16, -0.5]
@@ -23,6 +24,7 @@ int main() {
     PairwiseSummator pairwiseSum;
     KahanSummator kahanSum;
     NeumaierSummator neumaierSum;
+    ExactSummator exactSum;
 
     // Compute the sums using the different algorithms.
     double sumForLoop = forLoopSum.sum(vec);
@@ -30,6 +32,7 @@ int main() {
     double sumPairwise = pairwiseSum.sum(vec);
     double sumKahan = kahanSum.sum(vec);
     double sumNeumaier = neumaierSum.sum(vec);
+    double sumExact = exactSum.sum(vec);
 
     // Print the results.
     // Analytic solution
@@ -51,13 +54,17 @@ int main() {
     std::cout << "Neumaier summation:\n";
     std::cout << "Computed sum: " << sumNeumaier << "\n\n";
 
+    std::cout << "Exact summation:\n";
+    std::cout << "Computed sum: " << sumExact << "\n\n";
+
     // Explanation of results
     std::cout <<
         "\nExplanation of results:\n"
         "- Forloop and GSL: Suffer from catastrophic cancellation due to the overwhelming effect of large numbers over small ones, resulting in a sum of -0.5.\n"
         "- Pairwise: Groups similar-magnitude numbers together, but in this case, it separates the contributions in a way that cancels out the large terms without preserving the small net offset, returning 0.\n"
         "- Kahan: Introduces a compensation variable, yet still fails to recover the lost precision when faced with catastrophic cancellation, also yielding -0.5.\n"
-        "- Neumaier: Adjusts the compensation strategy to handle cases where the incoming term is larger than the current sum, successfully recovering the lost digits and producing the correct result, 0.5.\n";
+        "- Neumaier: Adjusts the compensation strategy to handle cases where the incoming term is larger than the current sum, successfully recovering the lost digits and producing the correct result, 0.5.\n"
+        "- Exact: Accumulates every term without rounding in a fixed-point superaccumulator and rounds only the final sum, so it returns the correctly rounded result, 0.5, for any input.\n";
     std::cout << std::endl;
 
     return 0;
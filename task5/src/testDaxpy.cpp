@@ -3,12 +3,15 @@
 #include "VectorSumGSL.hpp"
 #include <iostream>
 #include <cstdlib>
+#include <algorithm>
 
 /**
  * @brief Main entry point for running the DAXPY tests.
  *
  * This program runs tests for the DAXPY operation (d = a * x + y) using two implementations:
- * the default element-wise loop and the GSL-based method. It allows the user to override the default
+ * the default element-wise loop and the GSL-based method, and then times the fused
+ * expression-template kernel (d = a*x + y with sum(d) and dot(d, d) in one pass) and the
+ * batched multi-scalar sweep. It allows the user to override the default
  * vector size, scalar multiplier, and number of iterations through command-line arguments.
  *
  * Command-line arguments:
@@ -43,6 +46,15 @@ int main(int argc, char** argv) {
     // Execute the test suite for each implementation.
     run_vector_sum_test(n, a, n_iter, defaultSummator, "Default Implementation");
     run_vector_sum_test(n, a, n_iter, gslSummator, "GSL Implementation");
+
+    // DAXPY and the moments of d in one pass versus three.
+    run_fused_daxpy_test(n, a, n_iter);
+
+    // Parameter scan over up to 32 scalars: stored outputs versus the moments-only sweep.
+    // The batched outputs are capped at 256 MiB, so large n scans fewer scalars.
+    const std::size_t max_sweep_doubles = (std::size_t(256) << 20) / sizeof(double);
+    const std::size_t n_scalars = std::max<std::size_t>(1, std::min<std::size_t>(32, max_sweep_doubles / std::max<std::size_t>(n, 1)));
+    run_daxpy_sweep_test(n, a, n_scalars, std::max(1, n_iter / 10), defaultSummator);
     
     return 0;
 }
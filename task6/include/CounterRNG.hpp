@@ -0,0 +1,122 @@
+#ifndef COUNTER_RNG_HPP
+#define COUNTER_RNG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * @brief Counter‑based, reproducible random numbers (Philox4x32‑10).
+ *
+ * Philox maps a 128‑bit counter and a 64‑bit key to 128 random bits with
+ * ten rounds of 32×32→64 multiplications and xors; there is no state to
+ * carry from one draw to the next.  Element i of a Gaussian sequence is
+ * computed from counter ⌊i/2⌋ and key = seed only: the four output words
+ * give two 53‑bit uniforms, and one Box–Muller transform turns them into
+ * the pair (2k, 2k+1).
+ *
+ * Any index range [begin, end) can therefore be filled on its own — by one
+ * thread, many OpenMP threads or different MPI ranks — and the values are
+ * bitwise identical to filling the whole sequence at once with the same
+ * seed.  fill_gaussian() works in batches: the integer Philox rounds of a
+ * batch are a straight loop without dependencies (vectorized by the
+ * compiler), followed by a separate log/sqrt/sincos loop.
+ *
+ * The Gaussian values go through std::log/std::cos/std::sin, so they are
+ * reproducible on a given platform and libm; do not build with
+ * -ffast-math if bitwise identical results across range splits matter.
+ */
+namespace CounterRNG {
+
+/// Philox4x32‑10 block: out = Philox(counter, key).
+inline void philox4x32(std::uint64_t counter, std::uint64_t key, std::uint32_t out[4]) {
+    const std::uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+    const std::uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+
+    std::uint32_t c0 = std::uint32_t(counter), c1 = std::uint32_t(counter >> 32);
+    std::uint32_t c2 = 0, c3 = 0;
+    std::uint32_t k0 = std::uint32_t(key),     k1 = std::uint32_t(key >> 32);
+
+    for (int r = 0; r < 10; ++r) {
+        const std::uint64_t p0 = std::uint64_t(M0) * c0;
+        const std::uint64_t p1 = std::uint64_t(M1) * c2;
+        const std::uint32_t n0 = std::uint32_t(p1 >> 32) ^ c1 ^ k0;
+        const std::uint32_t n2 = std::uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c1 = std::uint32_t(p1);
+        c3 = std::uint32_t(p0);
+        c0 = n0;
+        c2 = n2;
+        k0 += W0;
+        k1 += W1;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+/// Uniform double in (0, 1] from two 32‑bit words (53 random bits).
+inline double to_unit(std::uint32_t hi, std::uint32_t lo) {
+    const std::uint64_t bits = ((std::uint64_t(hi) << 32) | lo) >> 11;
+    return (double(bits) + 1.0) * (1.0 / 9007199254740992.0);   // 2^-53
+}
+
+/// Standard normal pair for counter k: values of elements 2k and 2k+1.
+inline void gaussian_pair(std::uint64_t k, std::uint64_t seed, double& z0, double& z1) {
+    std::uint32_t w[4];
+    philox4x32(k, seed, w);
+    const double r   = std::sqrt(-2.0 * std::log(to_unit(w[0], w[1])));
+    const double phi = 6.283185307179586 * to_unit(w[2], w[3]);
+    z0 = r * std::cos(phi);
+    z1 = r * std::sin(phi);
+}
+
+/**
+ * @brief Fill out[0 .. end-begin) with elements [begin, end) of the
+ *        N(mean, stddev²) sequence for @p seed.
+ *
+ * Batches are shared among OpenMP threads when compiled with OpenMP; the
+ * result does not depend on the thread count or on how ranges are split.
+ */
+inline void fill_gaussian(double* out, std::uint64_t begin, std::uint64_t end,
+                          std::uint64_t seed, double mean = 0.0, double stddev = 1.0)
+{
+    if (end <= begin) return;
+    const std::uint64_t kBatch = 256;                       // pairs per batch
+    const std::uint64_t first  = begin / 2;                 // first pair touched
+    const std::uint64_t last   = (end - 1) / 2 + 1;         // one past the last pair
+    const long long nbatch = static_cast<long long>((last - first + kBatch - 1) / kBatch);
+
+    #pragma omp parallel for schedule(static)
+    for (long long b = 0; b < nbatch; ++b) {
+        const std::uint64_t p0 = first + std::uint64_t(b) * kBatch;
+        const std::uint64_t p1 = p0 + kBatch < last ? p0 + kBatch : last;
+        const std::uint64_t np = p1 - p0;
+
+        // 1) integer Philox rounds → uniforms
+        double u1[kBatch], u2[kBatch];
+        for (std::uint64_t j = 0; j < np; ++j) {
+            std::uint32_t w[4];
+            philox4x32(p0 + j, seed, w);
+            u1[j] = to_unit(w[0], w[1]);
+            u2[j] = to_unit(w[2], w[3]);
+        }
+        // 2) Box–Muller on the whole batch
+        double z[2 * kBatch];
+        for (std::uint64_t j = 0; j < np; ++j) {
+            const double r   = std::sqrt(-2.0 * std::log(u1[j]));
+            const double phi = 6.283185307179586 * u2[j];
+            z[2 * j]     = mean + stddev * (r * std::cos(phi));
+            z[2 * j + 1] = mean + stddev * (r * std::sin(phi));
+        }
+        // 3) copy the part of the batch inside [begin, end)
+        const std::uint64_t e0 = 2 * p0 > begin ? 2 * p0 : begin;
+        const std::uint64_t e1 = 2 * p1 < end   ? 2 * p1 : end;
+        for (std::uint64_t i = e0; i < e1; ++i)
+            out[i - begin] = z[i - 2 * p0];
+    }
+}
+
+} // namespace CounterRNG
+
+#endif // COUNTER_RNG_HPP
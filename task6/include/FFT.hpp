@@ -19,14 +19,110 @@ std::size_t next_power_of_two(std::size_t n);
  */
 void fft(std::vector<std::complex<double>>& a, bool invert);
 
+/**
+ * @brief 1D transform kernels a Plan can be bound to.
+ *   - CooleyTukey: in‑place, bit‑reversal permute + butterflies
+ *   - Stockham:    out‑of‑place autosort, ping‑pongs between the
+ *                  data and the plan workspace (no bit reversal)
+ *   - Codelet:     the FFT::fft path: unrolled 64‑point codelets as the
+ *                  base case, then table‑driven butterfly stages
+ */
+enum class Engine { CooleyTukey, Stockham, Codelet };
+
+/**
+ * @brief Reusable 1D transform plan for a fixed power‑of‑two length.
+ *
+ * Holds the forward twiddles W_n^k = exp(-2πik/n), k < n/2, and the
+ * scratch buffer needed by out‑of‑place engines, so repeated transforms
+ * of the same length do not recompute cos/sin or reallocate.
+ */
+struct Plan {
+    std::size_t n;
+    Engine engine;
+    std::vector<std::complex<double>> twiddles;
+    std::vector<std::complex<double>> work;
+};
+
+/**
+ * @brief Build a plan for length n (must be a power of two).
+ * @throws std::invalid_argument if n is not a power of two.
+ */
+Plan make_plan(std::size_t n, Engine engine = Engine::CooleyTukey);
+
+/**
+ * @brief Run the planned transform in place on a (same semantics as fft).
+ * @throws std::invalid_argument if a.size() != plan.n.
+ */
+void execute(Plan& plan, std::vector<std::complex<double>>& a, bool invert);
+
+/**
+ * @brief Plan for the forward real‑to‑complex transform of length n.
+ *
+ * The n real samples are packed into n/2 complex values, transformed with
+ * a half‑length complex plan and untangled with the W_n^k twiddles, so a
+ * real transform costs about half of the equivalent complex one.
+ */
+struct RealPlan {
+    std::size_t n;
+    Plan half;
+    std::vector<std::complex<double>> twiddles;
+    std::vector<std::complex<double>> packed;
+};
+
+/**
+ * @brief Build a real‑to‑complex plan for length n (power of two, n ≥ 2).
+ * @throws std::invalid_argument otherwise.
+ */
+RealPlan make_real_plan(std::size_t n, Engine engine = Engine::CooleyTukey);
+
+/**
+ * @brief Forward r2c transform: in[0..n-1] → out[0..n/2] (non‑negative bins).
+ */
+void execute_r2c(RealPlan& plan, const double* in, std::complex<double>* out);
+
+/**
+ * @brief How the column pass of fft2d walks the row‑major data.
+ *   - PerColumn: gather one column, transform it, scatter it back
+ *   - Blocked:   gather `block` adjacent columns per sweep over the rows,
+ *                so each row is touched once per block instead of per column
+ */
+enum class ColumnStrategy { PerColumn, Blocked };
+
+/**
+ * @brief Tunable execution parameters of fft2d (results do not depend on them).
+ */
+struct Fft2dConfig {
+    Engine         engine;   // 1D kernel for rows and columns
+    ColumnStrategy columns;  // column‑pass strategy
+    std::size_t    block;    // columns per block (Blocked only)
+    int            threads;  // OpenMP threads for both passes
+};
+
+/**
+ * @brief The built‑in fft2d configuration, used when no wisdom is available:
+ *        codelet engine, per‑column pass, single thread.
+ */
+Fft2dConfig default_fft2d_config();
+
 /**
  * @brief 2D FFT that pads both dims to powers of two,
  *        applies FFT on rows then cols, and returns the full M×N.
+ *
+ * The execution configuration for the padded size comes from the wisdom
+ * table (see Wisdom.hpp), which may tune it on first use.
  */
 std::vector<std::vector<std::complex<double>>>
 fft2d(const std::vector<std::vector<std::complex<double>>>& input,
       bool invert);
 
+/**
+ * @brief Same as above with an explicit execution configuration.
+ */
+std::vector<std::vector<std::complex<double>>>
+fft2d(const std::vector<std::vector<std::complex<double>>>& input,
+      bool invert,
+      const Fft2dConfig& config);
+
 /**
  * @brief Real‑to‑complex 2D FFT “trimmed” wrapper:
  *   1) promote real → complex,
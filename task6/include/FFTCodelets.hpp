@@ -0,0 +1,154 @@
+#ifndef FFT_CODELETS_HPP
+#define FFT_CODELETS_HPP
+
+#include <complex>
+#include <cstddef>
+
+namespace FFT {
+namespace codelet {
+
+/**
+ * @brief Fully unrolled small power‑of‑two DFTs generated at compile time.
+ *
+ * Codelet<N, Inv>::run(in, s, out) computes the length‑N DFT of the strided
+ * input in[0], in[s], …, in[(N-1)s] into the contiguous out[0..N-1]
+ * (unnormalized; Inv selects the +i sign).  The recursion is resolved by the
+ * compiler, so there is no loop control, no bit reversal and no cos/sin at
+ * run time: every twiddle is a constexpr entry of the tables below.
+ */
+
+// Largest length with a generated codelet.
+constexpr std::size_t kMaxSize = 64;
+
+// cos(2πk/64) and sin(2πk/64) for k = 0…31; W_N^k = kCos[k·64/N] ∓ i·kSin[k·64/N].
+constexpr double kCos[kMaxSize / 2] = {
+                      1.0,   0.99518472667219693,   0.98078528040323043,   0.95694033573220882,
+      0.92387953251128674,   0.88192126434835505,   0.83146961230254524,   0.77301045336273699,
+      0.70710678118654757,   0.63439328416364549,   0.55557023301960218,   0.47139673682599764,
+      0.38268343236508978,   0.29028467725446233,   0.19509032201612825,  0.098017140329560604,
+                      0.0, -0.098017140329560604,  -0.19509032201612825,  -0.29028467725446233,
+     -0.38268343236508978,  -0.47139673682599764,  -0.55557023301960218,  -0.63439328416364549,
+     -0.70710678118654757,  -0.77301045336273699,  -0.83146961230254524,  -0.88192126434835505,
+     -0.92387953251128674,  -0.95694033573220882,  -0.98078528040323043,  -0.99518472667219693
+};
+constexpr double kSin[kMaxSize / 2] = {
+                      0.0,  0.098017140329560604,   0.19509032201612825,   0.29028467725446233,
+      0.38268343236508978,   0.47139673682599764,   0.55557023301960218,   0.63439328416364549,
+      0.70710678118654757,   0.77301045336273699,   0.83146961230254524,   0.88192126434835505,
+      0.92387953251128674,   0.95694033573220882,   0.98078528040323043,   0.99518472667219693,
+                      1.0,   0.99518472667219693,   0.98078528040323043,   0.95694033573220882,
+      0.92387953251128674,   0.88192126434835505,   0.83146961230254524,   0.77301045336273699,
+      0.70710678118654757,   0.63439328416364549,   0.55557023301960218,   0.47139673682599764,
+      0.38268343236508978,   0.29028467725446233,   0.19509032201612825,  0.098017140329560604
+};
+
+using cd = std::complex<double>;
+
+// One radix‑2 butterfly on out[k], out[k + N/2] with the constant twiddle W_N^k.
+template <std::size_t N, std::size_t k, bool Inv>
+inline void butterfly(cd* out) {
+    constexpr std::size_t idx = k * (kMaxSize / N);
+    constexpr double wr = kCos[idx];
+    constexpr double wi = Inv ? kSin[idx] : -kSin[idx];
+    const cd e = out[k];
+    const cd o = out[k + N / 2];
+    const cd t(o.real() * wr - o.imag() * wi,
+               o.real() * wi + o.imag() * wr);
+    out[k]         = e + t;
+    out[k + N / 2] = e - t;
+}
+
+// Unrolled combine step: butterflies k = 0 … K-1 of a length‑N stage.
+template <std::size_t N, std::size_t K, bool Inv>
+struct Combine {
+    static inline void run(cd* out) {
+        Combine<N, K - 1, Inv>::run(out);
+        butterfly<N, K - 1, Inv>(out);
+    }
+};
+
+// k = 0 has the trivial twiddle 1: skip the multiply.
+template <std::size_t N, bool Inv>
+struct Combine<N, 1, Inv> {
+    static inline void run(cd* out) {
+        const cd e = out[0];
+        const cd o = out[N / 2];
+        out[0]     = e + o;
+        out[N / 2] = e - o;
+    }
+};
+
+// Decimation in time: DFT of even and odd samples, then combine.
+template <std::size_t N, bool Inv>
+struct Codelet {
+    static_assert(N >= 2 && N <= kMaxSize && (N & (N - 1)) == 0,
+                  "codelet length must be a power of two in [2, kMaxSize]");
+    static inline void run(const cd* in, std::size_t s, cd* out) {
+        Codelet<N / 2, Inv>::run(in,     2 * s, out);
+        Codelet<N / 2, Inv>::run(in + s, 2 * s, out + N / 2);
+        Combine<N, N / 2, Inv>::run(out);
+    }
+};
+
+template <bool Inv>
+struct Codelet<2, Inv> {
+    static inline void run(const cd* in, std::size_t s, cd* out) {
+        const cd a = in[0];
+        const cd b = in[s];
+        out[0] = a + b;
+        out[1] = a - b;
+    }
+};
+
+/**
+ * Stages<N, Inv>::run(x) performs, in place, the first log2(N) butterfly
+ * stages of a transform on the contiguous block x[0..N-1], whose elements
+ * are already in bit‑reversed order; this gives the same values as Codelet
+ * on the unpermuted, strided input.
+ */
+template <std::size_t N, bool Inv>
+struct Stages {
+    static inline void run(cd* x) {
+        Stages<N / 2, Inv>::run(x);
+        Stages<N / 2, Inv>::run(x + N / 2);
+        Combine<N, N / 2, Inv>::run(x);
+    }
+};
+
+template <bool Inv>
+struct Stages<1, Inv> {
+    static inline void run(cd*) {}
+};
+
+template <std::size_t N>
+inline void run_stages(cd* x, bool invert) {
+    if (invert) Stages<N, true>::run(x);
+    else        Stages<N, false>::run(x);
+}
+
+template <std::size_t N>
+inline void run_fixed(const cd* in, std::size_t s, cd* out, bool invert) {
+    if (invert) Codelet<N, true>::run(in, s, out);
+    else        Codelet<N, false>::run(in, s, out);
+}
+
+/**
+ * @brief Run the codelet for length n, if one exists.
+ * @return false (and leaves out untouched) if n has no codelet.
+ */
+inline bool run(std::size_t n, const cd* in, std::size_t s, cd* out, bool invert) {
+    switch (n) {
+        case 2:  run_fixed<2>(in, s, out, invert);  return true;
+        case 4:  run_fixed<4>(in, s, out, invert);  return true;
+        case 8:  run_fixed<8>(in, s, out, invert);  return true;
+        case 16: run_fixed<16>(in, s, out, invert); return true;
+        case 32: run_fixed<32>(in, s, out, invert); return true;
+        case 64: run_fixed<64>(in, s, out, invert); return true;
+        default: return false;
+    }
+}
+
+} // namespace codelet
+} // namespace FFT
+
+#endif // FFT_CODELETS_HPP
@@ -0,0 +1,125 @@
+#ifndef STFT_HPP
+#define STFT_HPP
+
+#include <vector>
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include "FFT.hpp"
+
+namespace FFT {
+
+/**
+ * @brief Analysis windows supported by make_window().
+ */
+enum class Window { Rectangular, Hann, Hamming, Blackman };
+
+/**
+ * @brief Periodic window of the given length (DFT‑even, as used for spectra).
+ */
+std::vector<double> make_window(Window w, std::size_t length);
+
+/**
+ * @brief Parse "rectangular" | "hann" | "hamming" | "blackman".
+ * @throws std::invalid_argument on an unknown name.
+ */
+Window window_from_name(const std::string& name);
+
+/**
+ * @brief Streaming short‑time Fourier transform of a real signal.
+ *
+ * Frame f covers samples [f·hop, f·hop + window.size()); it is multiplied
+ * by the window, zero‑padded to fft_length and transformed.  Only the
+ * fft_length/2+1 non‑negative frequency bins are emitted.
+ *
+ * Samples are fed incrementally with push(); every frame that becomes
+ * complete is computed and handed to the sink in frame order, so input of
+ * any length can be processed with a bounded buffer.  Ready frames are
+ * transformed in batches of `batch` frames spread across OpenMP threads,
+ * each thread reusing its own copy of one plan and one scratch buffer.
+ * Trailing samples that do not fill a whole frame are never emitted.
+ */
+class STFT {
+public:
+    /// Receives (frame index, bins) for complex output.
+    typedef std::function<void(std::size_t, const std::vector<std::complex<double>>&)>
+        ComplexSink;
+    /// Receives (frame index, |bins|) for magnitude output.
+    typedef std::function<void(std::size_t, const std::vector<double>&)>
+        MagnitudeSink;
+
+    /**
+     * @throws std::invalid_argument if the window is empty or longer than
+     *         fft_length, hop == 0, batch == 0, or fft_length is not a
+     *         power of two.
+     */
+    STFT(std::vector<double> window,
+         std::size_t hop,
+         std::size_t fft_length,
+         Engine engine = Engine::CooleyTukey,
+         std::size_t batch = 64);
+
+    /// Emit complex frames to sink (replaces any previous sink).
+    void set_sink(ComplexSink sink);
+    /// Emit magnitude frames to sink (replaces any previous sink).
+    void set_sink(MagnitudeSink sink);
+
+    /// Append count samples and emit every frame completed by them.
+    void push(const double* samples, std::size_t count);
+    void push(const std::vector<double>& samples) { push(samples.data(), samples.size()); }
+
+    /// Forget buffered samples and restart frame numbering at 0.
+    void reset();
+
+    std::size_t fft_length()   const { return n_; }
+    std::size_t bins()         const { return n_ / 2 + 1; }
+    std::size_t hop()          const { return hop_; }
+    std::size_t frames_emitted() const { return next_frame_; }
+
+private:
+    void process_ready_frames();
+    void transform_batch(std::size_t first_frame, std::size_t count);
+    void emit_batch(std::size_t first_frame, std::size_t count);
+
+    std::vector<double> window_;
+    std::size_t hop_;
+    std::size_t n_;
+    std::size_t batch_;
+
+    // one plan + scratch per OpenMP thread, grown if the thread count rises
+    std::vector<Plan> plans_;
+    std::vector<std::vector<std::complex<double>>> scratch_;
+
+    // frames × bins output of the current batch
+    std::vector<std::complex<double>> batch_out_;
+    std::vector<std::complex<double>> frame_bins_;
+    std::vector<double> frame_mag_;
+
+    // samples [buffer_start_, buffer_start_ + pending_.size())
+    std::vector<double> pending_;
+    std::size_t buffer_start_;
+    std::size_t next_frame_;
+
+    ComplexSink   complex_sink_;
+    MagnitudeSink magnitude_sink_;
+};
+
+/**
+ * @brief Stream a whole signal file through an STFT, chunk by chunk.
+ *
+ * Supports the binary ".dat" (raw native doubles) and ".h5" (1D dataset
+ * named `dataset`) formats; at most chunk samples are held in memory by
+ * the reader at any time.
+ *
+ * @return number of samples read.
+ * @throws std::runtime_error if the file cannot be read.
+ */
+std::size_t stft_stream_file(const std::string& filename,
+                             STFT& stft,
+                             std::size_t chunk = std::size_t(1) << 20,
+                             const std::string& dataset = "signal");
+
+} // namespace FFT
+
+#endif // STFT_HPP
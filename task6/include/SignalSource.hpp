@@ -0,0 +1,49 @@
+#ifndef SIGNAL_SOURCE_HPP
+#define SIGNAL_SOURCE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FFT {
+
+/**
+ * @brief Sequential, chunked reader for a 1D real signal stored on disk.
+ *
+ * The format is chosen from the file extension:
+ *   - ".dat": raw native‑endian doubles, no header;
+ *   - ".h5":  a 1D double dataset (default name "signal"), read through
+ *             hyperslab selections so only the requested chunk is loaded.
+ */
+class SignalSource {
+public:
+    /**
+     * @throws std::runtime_error if the file cannot be opened, the extension
+     *         is unsupported, or the HDF5 dataset is not one‑dimensional.
+     */
+    explicit SignalSource(const std::string& filename,
+                          const std::string& dataset = "signal");
+    ~SignalSource();
+
+    /// Total number of samples in the file.
+    std::size_t size() const;
+    /// Samples not read yet.
+    std::size_t remaining() const;
+
+    /**
+     * @brief Read up to count samples into out.
+     * @return number of samples read (0 once the file is exhausted).
+     * @throws std::runtime_error on an I/O error.
+     */
+    std::size_t read(double* out, std::size_t count);
+    std::size_t read(std::vector<double>& out, std::size_t count);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace FFT
+
+#endif // SIGNAL_SOURCE_HPP
@@ -10,6 +10,10 @@
 #include <cmath>
 #include <iostream>
 #include <string>
+#include <cstdint>
+#include <cstring>
+#include <omp.h>
+#include "CounterRNG.hpp"
 
 using cd = std::complex<double>;
 
@@ -23,22 +27,40 @@ struct ErrorStats {
 
 /**
  * @brief Generate an M×N matrix of Gaussian random values.
+ *
+ * Element (i, j) is element i·N + j of the counter‑based sequence for
+ * @p seed (CounterRNG.hpp), so the matrix is reproducible for a given seed
+ * and its rows are filled in parallel.
  */
 inline std::vector<std::vector<double>>
 generate_gaussian_matrix(size_t M,
                          size_t N,
                          double mean,
-                         double stddev)
+                         double stddev,
+                         uint64_t seed)
 {
-    std::mt19937_64 gen{std::random_device{}()};
-    std::normal_distribution<double> dist{mean, stddev};
     std::vector<std::vector<double>> A(M, std::vector<double>(N));
-    for (auto& row : A)
-        for (auto& x : row)
-            x = dist(gen);
+    const long long rows = static_cast<long long>(M);
+    #pragma omp parallel for schedule(static)
+    for (long long i = 0; i < rows; ++i)
+        CounterRNG::fill_gaussian(A[i].data(), uint64_t(i) * N, uint64_t(i + 1) * N,
+                                  seed, mean, stddev);
     return A;
 }
 
+/**
+ * @brief Same as above with a fresh seed from std::random_device.
+ */
+inline std::vector<std::vector<double>>
+generate_gaussian_matrix(size_t M,
+                         size_t N,
+                         double mean,
+                         double stddev)
+{
+    std::random_device rd;
+    return generate_gaussian_matrix(M, N, mean, stddev, (uint64_t(rd()) << 32) ^ rd());
+}
+
 /**
  * @brief Promote a real matrix to complex (imag=0).
  */
@@ -54,27 +76,183 @@ promote_to_complex(const std::vector<std::vector<double>>& A)
     return out;
 }
 
-// internal helper: RMSE & median‐of‐squares
-static inline void compute_two_stats(const std::vector<double>& e,
-                                     double& out_rmse,
-                                     double& out_medrse)
-{
-    size_t N = e.size();
-    std::vector<double> sq(N);
-    for (size_t i = 0; i < N; ++i) sq[i] = e[i]*e[i];
-
-    double mean_sq = std::accumulate(sq.begin(), sq.end(), 0.0)/double(N);
-    out_rmse = std::sqrt(mean_sq);
-
-    auto mid = sq.begin() + N/2;
-    std::nth_element(sq.begin(), mid, sq.end());
-    double med = *mid;
-    if (N%2==0) {
-        double lo = *std::max_element(sq.begin(), mid);
-        med = 0.5*(med + lo);
+/**
+ * @brief Parallel, allocation‑light engine for round‑trip error statistics.
+ *
+ * The data are registered as contiguous segments (typically matrix rows)
+ * without being copied; `rec` may be strided, e.g. the real parts of a
+ * complex row.  compute() derives e = rec − orig and e/orig on the fly and
+ * returns absolute and relative RMSE and MedRSE together:
+ *
+ *   - sweep 1: Neumaier‑compensated Σe² per thread (merged in thread order)
+ *     plus a 65536‑bucket histogram of the top 16 bits of e²;
+ *   - sweep 2: histogram of the next 16 bits inside the bucket(s) that hold
+ *     the median rank(s);
+ *   - sweep 3: gather the few e² sharing the resulting 32‑bit prefix and
+ *     finish with nth_element.
+ *
+ * The bit pattern of a non‑negative double is monotone in its value, so the
+ * median is exact and matches the sort‑based definition (mean of the two
+ * middle squares for an even count).  No O(M·N) buffer is ever allocated.
+ */
+class ErrorStatsEngine {
+public:
+    void add_segment(const double* orig, const double* rec,
+                     size_t n, size_t rec_stride = 1)
+    {
+        segments_.push_back(Segment{ orig, rec, n, rec_stride });
+        count_ += n;
     }
-    out_medrse = std::sqrt(med);
-}
+
+    size_t size() const { return count_; }
+
+    ErrorStats compute() const {
+        ErrorStats s{0.0, 0.0, 0.0, 0.0};
+        if (count_ == 0) return s;
+
+        const int T = std::max(1, omp_get_max_threads());
+        const size_t B = size_t(1) << kBits;
+
+        // sweep 1: Σe², Σ(e/orig)² and top‑level histograms
+        std::vector<Neumaier> sum_abs(T), sum_rel(T);
+        std::vector<std::vector<size_t>> hist(2 * T, std::vector<size_t>(B, 0));
+        sweep([&](int tid, double ea, double er) {
+            const double qa = ea * ea, qr = er * er;
+            sum_abs[tid].add(qa);
+            sum_rel[tid].add(qr);
+            ++hist[2 * tid    ][key(qa) >> 48];
+            ++hist[2 * tid + 1][key(qr) >> 48];
+        });
+        Neumaier total_abs, total_rel;
+        for (int t = 0; t < T; ++t) {
+            total_abs.merge(sum_abs[t]);
+            total_rel.merge(sum_rel[t]);
+        }
+        s.rmse_abs = std::sqrt(total_abs.value() / double(count_));
+        s.rmse_rel = std::sqrt(total_rel.value() / double(count_));
+
+        // median rank(s) of the sorted squares, per metric
+        std::vector<Target> targets[2];
+        for (int m = 0; m < 2; ++m) {
+            if (count_ % 2 == 0) targets[m].push_back(Target{ 0, count_ / 2 - 1 });
+            targets[m].push_back(Target{ 0, count_ / 2 });
+            std::vector<size_t> h(B, 0);
+            for (int t = 0; t < T; ++t)
+                for (size_t b = 0; b < B; ++b) h[b] += hist[2 * t + m][b];
+            for (auto& tg : targets[m]) descend(h, tg);
+        }
+
+        // sweep 2: next 16 bits inside each target bucket
+        const size_t nt = targets[0].size();
+        std::vector<std::vector<size_t>> hist2(2 * nt * T, std::vector<size_t>(B, 0));
+        sweep([&](int tid, double ea, double er) {
+            const uint64_t k[2] = { key(ea * ea), key(er * er) };
+            for (int m = 0; m < 2; ++m)
+                for (size_t t = 0; t < nt; ++t)
+                    if ((k[m] >> 48) == targets[m][t].prefix)
+                        ++hist2[(tid * 2 + m) * nt + t][(k[m] >> 32) & (B - 1)];
+        });
+        for (int m = 0; m < 2; ++m)
+            for (size_t t = 0; t < nt; ++t) {
+                std::vector<size_t> h(B, 0);
+                for (int th = 0; th < T; ++th)
+                    for (size_t b = 0; b < B; ++b) h[b] += hist2[(th * 2 + m) * nt + t][b];
+                descend(h, targets[m][t]);
+            }
+
+        // sweep 3: gather the squares sharing each 32‑bit prefix
+        std::vector<std::vector<double>> cand(2 * nt * T);
+        sweep([&](int tid, double ea, double er) {
+            const double q[2] = { ea * ea, er * er };
+            for (int m = 0; m < 2; ++m) {
+                const uint64_t k = key(q[m]);
+                for (size_t t = 0; t < nt; ++t)
+                    if ((k >> 32) == targets[m][t].prefix)
+                        cand[(tid * 2 + m) * nt + t].push_back(q[m]);
+            }
+        });
+        double med[2];
+        for (int m = 0; m < 2; ++m) {
+            double acc = 0.0;
+            for (size_t t = 0; t < nt; ++t) {
+                std::vector<double> c;
+                for (int th = 0; th < T; ++th) {
+                    const auto& part = cand[(th * 2 + m) * nt + t];
+                    c.insert(c.end(), part.begin(), part.end());
+                }
+                auto nth = c.begin() + targets[m][t].rank;
+                std::nth_element(c.begin(), nth, c.end(),
+                                 [](double a, double b) { return key(a) < key(b); });
+                acc += *nth;
+            }
+            med[m] = acc / double(nt);
+        }
+        s.medrse_abs = std::sqrt(med[0]);
+        s.medrse_rel = std::sqrt(med[1]);
+        return s;
+    }
+
+private:
+    static const int kBits = 16;
+
+    struct Segment {
+        const double* orig;
+        const double* rec;
+        size_t n;
+        size_t rec_stride;
+    };
+
+    struct Target {
+        uint64_t prefix;   // key bits resolved so far
+        size_t   rank;     // rank among the keys sharing that prefix
+    };
+
+    struct Neumaier {
+        double s = 0.0, c = 0.0;
+        void add(double x) {
+            const double t = s + x;
+            c += std::fabs(s) >= std::fabs(x) ? (s - t) + x : (x - t) + s;
+            s = t;
+        }
+        void merge(const Neumaier& o) { add(o.s); add(o.c); }
+        double value() const { return s + c; }
+    };
+
+    // order‑preserving key of a non‑negative double (sign bit dropped)
+    static uint64_t key(double q) {
+        uint64_t k;
+        std::memcpy(&k, &q, sizeof k);
+        return k & 0x7FFFFFFFFFFFFFFFull;
+    }
+
+    // pick the bucket holding tg.rank and refine the target by 16 bits
+    static void descend(const std::vector<size_t>& h, Target& tg) {
+        size_t b = 0;
+        while (tg.rank >= h[b]) tg.rank -= h[b++];
+        tg.prefix = (tg.prefix << kBits) | b;
+    }
+
+    // call f(thread, e, e/orig) for every element, split across OpenMP threads
+    template <typename F>
+    void sweep(F f) const {
+        #pragma omp parallel
+        {
+            const int tid = omp_get_thread_num();
+            for (const Segment& sg : segments_) {
+                const long long n = static_cast<long long>(sg.n);
+                #pragma omp for schedule(static) nowait
+                for (long long i = 0; i < n; ++i) {
+                    const double orig = sg.orig[i];
+                    const double e    = sg.rec[size_t(i) * sg.rec_stride] - orig;
+                    f(tid, e, e / orig);
+                }
+            }
+        }
+    }
+
+    std::vector<Segment> segments_;
+    size_t count_ = 0;
+};
 
 /**
  * @brief Errors for complex→complex roundtrip.
@@ -84,22 +262,12 @@ inline ErrorStats evaluate_c2c_roundtrip(
     const std::vector<std::vector<cd>>&     Arec)
 {
     size_t M = A.size(), N = A[0].size();
-    std::vector<double> abs_err; abs_err.reserve(M*N);
-    std::vector<double> rel_err; rel_err.reserve(M*N);
-
+    ErrorStatsEngine engine;
+    // real parts of a complex row: every other double
     for (size_t i = 0; i < M; ++i)
-    for (size_t j = 0; j < N; ++j) {
-        double orig = A[i][j];
-        double rec  = Arec[i][j].real();
-        double e    = rec - orig;
-        abs_err.push_back(e);
-        rel_err.push_back(e/orig);
-    }
-
-    ErrorStats s;
-    compute_two_stats(abs_err, s.rmse_abs,  s.medrse_abs);
-    compute_two_stats(rel_err, s.rmse_rel,  s.medrse_rel);
-    return s;
+        engine.add_segment(A[i].data(),
+                           reinterpret_cast<const double*>(Arec[i].data()), N, 2);
+    return engine.compute();
 }
 
 /**
@@ -110,22 +278,10 @@ inline ErrorStats evaluate_r2c_roundtrip(
     const std::vector<std::vector<double>>& Arec)
 {
     size_t M = A.size(), N = A[0].size();
-    std::vector<double> abs_err; abs_err.reserve(M*N);
-    std::vector<double> rel_err; rel_err.reserve(M*N);
-
+    ErrorStatsEngine engine;
     for (size_t i = 0; i < M; ++i)
-    for (size_t j = 0; j < N; ++j) {
-        double orig = A[i][j];
-        double rec  = Arec[i][j];
-        double e    = rec - orig;
-        abs_err.push_back(e);
-        rel_err.push_back(e/orig);
-    }
-
-    ErrorStats s;
-    compute_two_stats(abs_err, s.rmse_abs,  s.medrse_abs);
-    compute_two_stats(rel_err, s.rmse_rel,  s.medrse_rel);
-    return s;
+        engine.add_segment(A[i].data(), Arec[i].data(), N);
+    return engine.compute();
 }
 
 /**
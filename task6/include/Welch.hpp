@@ -0,0 +1,99 @@
+#ifndef WELCH_HPP
+#define WELCH_HPP
+
+#include <vector>
+#include <complex>
+#include <cstddef>
+#include <string>
+#include "FFT.hpp"
+
+namespace FFT {
+
+/**
+ * @brief Streaming Welch power spectral density estimator for a real signal.
+ *
+ * The signal is cut into segments of window.size() samples (a power of two,
+ * also the FFT length) that overlap by `overlap` samples.  Each segment is
+ * windowed, transformed with a real‑to‑complex plan, and |X_k|² is added to
+ * an accumulator.  psd() returns the one‑sided density
+ *
+ *     P_k = c_k · Σ_seg |X_k|² / (K · fs · Σ w²),   c_k = 1 at DC/Nyquist, else 2,
+ *
+ * averaged over the K segments seen so far (no detrending).
+ *
+ * Segments completed by a push() are split across OpenMP threads; every
+ * thread owns one plan, one segment buffer and one accumulator, which are
+ * only reduced (in thread order) when psd() is called.  Samples are copied
+ * into an internal buffer only at the seams between pushes, so pushing one
+ * large in‑memory record streams it straight through the FFTs.
+ */
+class WelchPSD {
+public:
+    /**
+     * @throws std::invalid_argument if window.size() is not a power of two
+     *         ≥ 2, overlap ≥ window.size(), or fs ≤ 0.
+     */
+    WelchPSD(std::vector<double> window,
+             std::size_t overlap,
+             double fs = 1.0,
+             Engine engine = Engine::CooleyTukey);
+
+    /// Append count samples and accumulate every segment they complete.
+    void push(const double* samples, std::size_t count);
+    void push(const std::vector<double>& samples) { push(samples.data(), samples.size()); }
+
+    /// Forget all samples and accumulated segments.
+    void reset();
+
+    /// One‑sided PSD estimate (segment_length/2+1 bins); zeros if no segment yet.
+    std::vector<double> psd() const;
+    /// Bin frequencies k·fs/segment_length matching psd().
+    std::vector<double> frequencies() const;
+
+    std::size_t segments()       const { return next_segment_; }
+    std::size_t segment_length() const { return window_.size(); }
+    std::size_t step()           const { return step_; }
+
+private:
+    void accumulate(const double* base, std::size_t base_offset,
+                    std::size_t first_segment, std::size_t count);
+
+    std::vector<double> window_;
+    std::size_t step_;
+    double fs_;
+    double window_power_;   // Σ w²
+
+    // per OpenMP thread (grown if the thread count rises): plan, windowed
+    // segment, spectrum, |X|² accumulator
+    std::vector<RealPlan> plans_;
+    std::vector<std::vector<double>> segment_;
+    std::vector<std::vector<std::complex<double>>> spectrum_;
+    std::vector<std::vector<double>> acc_;
+
+    // samples [buffer_start_, buffer_start_ + pending_.size()) not yet consumed
+    std::vector<double> pending_;
+    std::size_t buffer_start_;
+    std::size_t next_segment_;
+};
+
+/**
+ * @brief One‑shot Welch PSD of an in‑memory signal.
+ */
+std::vector<double> welch_psd(const std::vector<double>& x,
+                              const std::vector<double>& window,
+                              std::size_t overlap,
+                              double fs = 1.0);
+
+/**
+ * @brief Stream a ".dat" / ".h5" signal file into a WelchPSD chunk by chunk.
+ * @return number of samples read.
+ * @throws std::runtime_error if the file cannot be read.
+ */
+std::size_t welch_stream_file(const std::string& filename,
+                              WelchPSD& welch,
+                              std::size_t chunk = std::size_t(1) << 22,
+                              const std::string& dataset = "signal");
+
+} // namespace FFT
+
+#endif // WELCH_HPP
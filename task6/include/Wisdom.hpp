@@ -0,0 +1,75 @@
+#ifndef WISDOM_HPP
+#define WISDOM_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "FFT.hpp"
+
+namespace FFT {
+namespace wisdom {
+
+/**
+ * @brief Persisted auto‑tuning ("wisdom") for fft2d.
+ *
+ * For each padded size M×N the table stores the fastest Fft2dConfig
+ * measured on this machine.  fft2d() asks fft2d_config() for its size:
+ *   1) on first use the wisdom file is loaded (FFT_WISDOM_FILE, default
+ *      "fft_wisdom.txt" in the working directory);
+ *   2) a stored entry is used as is, without re‑measuring;
+ *   3) otherwise, if auto‑tuning is enabled and the size is large enough
+ *      for the choice to matter, every candidate is timed once, the winner
+ *      is recorded and the file is rewritten (concurrent callers for the
+ *      same size wait for that one tuning run instead of repeating it);
+ *   4) otherwise default_fft2d_config() is used.
+ *
+ * Auto‑tuning is on by default; set FFT_WISDOM_AUTOTUNE=0 or call
+ * set_autotune(false) to disable it.  The file holds one line per size:
+ *
+ *     fft2d <M> <N> <engine> <columns> <block> <threads>
+ */
+
+/// One measured candidate.
+struct Timing {
+    Fft2dConfig config;
+    double      seconds;
+};
+
+/// Configuration fft2d uses for the padded size M×N (may tune, see above).
+Fft2dConfig fft2d_config(std::size_t M, std::size_t N);
+
+/// Candidate configurations considered for M×N.
+std::vector<Fft2dConfig> fft2d_candidates(std::size_t M, std::size_t N);
+
+/**
+ * @brief Time every candidate for M×N, record the fastest and save the file.
+ * @return all timings, fastest first.
+ */
+std::vector<Timing> tune_fft2d(std::size_t M, std::size_t N);
+
+/// Store / look up an entry in the in‑memory table.
+void record(std::size_t M, std::size_t N, const Fft2dConfig& config);
+bool lookup(std::size_t M, std::size_t N, Fft2dConfig& config);
+
+/// Replace the table with the file's entries; false if it cannot be read.
+bool load(const std::string& path);
+/// Write the table; false if the file cannot be written.
+bool save(const std::string& path);
+
+/// Wisdom file used by fft2d_config() and tune_fft2d().
+std::string file();
+void set_file(const std::string& path);
+
+void set_autotune(bool enabled);
+bool autotune();
+
+/// Drop all in‑memory entries (the file is left untouched).
+void forget();
+
+/// Text forms used in the wisdom file.
+std::string to_string(const Fft2dConfig& config);
+
+} // namespace wisdom
+} // namespace FFT
+
+#endif // WISDOM_HPP
@@ -1,6 +1,9 @@
 #include "FFT.hpp"
+#include "FFTCodelets.hpp"
+#include "Wisdom.hpp"
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 namespace FFT {
 
@@ -14,13 +17,112 @@ std::size_t next_power_of_two(std::size_t n) {
 }
 
 // ————————————————————————————————————————————————————————————————
-// Primitive in‑place Cooley–Tukey FFT
+// Primitive Cooley–Tukey FFT
+//   n ≤ codelet::kMaxSize : one unrolled codelet
+//   larger n              : in‑place bit reversal, unrolled codelet stages
+//                           on contiguous blocks of kMaxSize, then the
+//                           remaining butterfly stages (no allocation)
 // ————————————————————————————————————————————————————————————————
+static std::size_t reverse_bits(std::size_t x, std::size_t nbits) {
+    std::size_t r = 0;
+    for (std::size_t b = 0; b < nbits; ++b, x >>= 1)
+        r = (r << 1) | (x & 1);
+    return r;
+}
+
+// Codelet pass: out[b·B … b·B+B-1] = DFT_B of in[rev(b) + k·(n/B)], k < B,
+// with B = min(n, kMaxSize); exactly the first log2(B) stages of the
+// bit‑reversed transform.  in and out must not alias.
+static void codelet_pass(const std::complex<double>* in,
+                         std::complex<double>* out,
+                         std::size_t n, bool invert)
+{
+    const std::size_t B      = std::min(n, codelet::kMaxSize);
+    const std::size_t blocks = n / B;
+    std::size_t lg = 0;
+    while ((std::size_t(1) << lg) < blocks) ++lg;
+
+    for (std::size_t b = 0; b < blocks; ++b)
+        codelet::run(B, in + reverse_bits(b, lg), blocks, out + b * B, invert);
+}
+
 void fft(std::vector<std::complex<double>>& a, bool invert) {
     const std::size_t n = a.size();
     if (n < 2) return;
 
-    // bit‑reversal permute
+    if (n <= codelet::kMaxSize) {
+        std::complex<double> in[codelet::kMaxSize];
+        std::copy(a.begin(), a.end(), in);
+        codelet_pass(in, a.data(), n, invert);
+    } else {
+        // bit‑reversal permute
+        for (std::size_t i = 1, j = 0; i < n; ++i) {
+            std::size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j |= bit;
+            if (i < j) std::swap(a[i], a[j]);
+        }
+
+        // first log2(kMaxSize) stages, one contiguous block at a time
+        for (std::size_t b = 0; b < n; b += codelet::kMaxSize)
+            codelet::run_stages<codelet::kMaxSize>(a.data() + b, invert);
+
+        // Cooley–Tukey butterflies for the remaining stages
+        for (std::size_t len = 2 * codelet::kMaxSize; len <= n; len <<= 1) {
+            double ang = 2 * M_PI / double(len) * (invert ? 1 : -1);
+            std::complex<double> wlen(std::cos(ang), std::sin(ang));
+            for (std::size_t i = 0; i < n; i += len) {
+                std::complex<double> w{1,0};
+                for (std::size_t k = 0; k < len/2; ++k) {
+                    auto u = a[i + k];
+                    auto v = a[i + k + len/2] * w;
+                    a[i + k]         = u + v;
+                    a[i + k + len/2] = u - v;
+                    w *= wlen;
+                }
+            }
+        }
+    }
+
+    // scale for inverse
+    if (invert) {
+        for (auto& x : a) x /= double(n);
+    }
+}
+
+// ————————————————————————————————————————————————————————————————
+// Plans: precomputed twiddles + workspace, engine chosen per plan
+// ————————————————————————————————————————————————————————————————
+Plan make_plan(std::size_t n, Engine engine) {
+    if (n == 0 || (n & (n - 1)) != 0)
+        throw std::invalid_argument("FFT plan length must be a power of two.");
+
+    Plan p;
+    p.n      = n;
+    p.engine = engine;
+    p.twiddles.resize(n / 2);
+    for (std::size_t k = 0; k < n / 2; ++k) {
+        double ang = -2 * M_PI * double(k) / double(n);
+        p.twiddles[k] = { std::cos(ang), std::sin(ang) };
+    }
+    if (engine != Engine::CooleyTukey)
+        p.work.resize(n);
+    return p;
+}
+
+// twiddle W_n^idx, conjugated for the inverse direction
+static inline std::complex<double>
+twiddle(const Plan& p, std::size_t idx, bool invert) {
+    return invert ? std::conj(p.twiddles[idx]) : p.twiddles[idx];
+}
+
+// in‑place Cooley–Tukey using the plan's twiddle table
+static void execute_cooley_tukey(const Plan& p,
+                                 std::complex<double>* a,
+                                 bool invert)
+{
+    const std::size_t n = p.n;
+
     for (std::size_t i = 1, j = 0; i < n; ++i) {
         std::size_t bit = n >> 1;
         for (; j & bit; bit >>= 1) j ^= bit;
@@ -28,49 +130,169 @@ void fft(std::vector<std::complex<double>>& a, bool invert) {
         if (i < j) std::swap(a[i], a[j]);
     }
 
-    // Cooley–Tukey butterflies
     for (std::size_t len = 2; len <= n; len <<= 1) {
-        double ang = 2 * M_PI / double(len) * (invert ? 1 : -1);
-        std::complex<double> wlen(std::cos(ang), std::sin(ang));
+        const std::size_t half   = len / 2;
+        const std::size_t stride = n / len;     // W_len^k = W_n^(k·n/len)
         for (std::size_t i = 0; i < n; i += len) {
-            std::complex<double> w{1,0};
-            for (std::size_t k = 0; k < len/2; ++k) {
+            for (std::size_t k = 0; k < half; ++k) {
                 auto u = a[i + k];
-                auto v = a[i + k + len/2] * w;
-                a[i + k]         = u + v;
-                a[i + k + len/2] = u - v;
-                w *= wlen;
+                auto v = a[i + k + half] * twiddle(p, k * stride, invert);
+                a[i + k]        = u + v;
+                a[i + k + half] = u - v;
             }
         }
     }
+}
+
+// Stockham autosort (radix‑2, decimation in frequency).
+// Stage with sub‑length m=len/2 and stride s reads x[q + s·p], x[q + s·(p+m)]
+// and writes y[q + s·2p], y[q + s·(2p+1)], so every pass streams through
+// both buffers contiguously in q and the output comes out in natural order.
+static void execute_stockham(Plan& p,
+                             std::complex<double>* a,
+                             bool invert)
+{
+    const std::size_t n = p.n;
+    std::complex<double>* x = a;
+    std::complex<double>* y = p.work.data();
+
+    for (std::size_t len = n, s = 1; len > 1; len >>= 1, s <<= 1) {
+        const std::size_t m = len / 2;
+        for (std::size_t q = 0; q < m; ++q) {
+            const auto w = twiddle(p, q * s, invert);   // W_len^q
+            const std::complex<double>* x0 = x + s * q;
+            const std::complex<double>* x1 = x + s * (q + m);
+            std::complex<double>*       y0 = y + s * (2 * q);
+            std::complex<double>*       y1 = y + s * (2 * q + 1);
+            for (std::size_t r = 0; r < s; ++r) {
+                const auto u = x0[r];
+                const auto v = x1[r];
+                y0[r] = u + v;
+                y1[r] = (u - v) * w;
+            }
+        }
+        std::swap(x, y);
+    }
+
+    // odd number of passes leaves the result in the workspace
+    if (x != a)
+        std::copy(x, x + n, a);
+}
+
+// codelet base case (input copied to the workspace), then table‑driven stages
+static void execute_codelet(Plan& p,
+                            std::complex<double>* a,
+                            bool invert)
+{
+    const std::size_t n = p.n;
+    std::copy(a, a + n, p.work.begin());
+    codelet_pass(p.work.data(), a, n, invert);
+
+    for (std::size_t len = 2 * codelet::kMaxSize; len <= n; len <<= 1) {
+        const std::size_t half   = len / 2;
+        const std::size_t stride = n / len;
+        for (std::size_t i = 0; i < n; i += len) {
+            for (std::size_t k = 0; k < half; ++k) {
+                auto u = a[i + k];
+                auto v = a[i + k + half] * twiddle(p, k * stride, invert);
+                a[i + k]        = u + v;
+                a[i + k + half] = u - v;
+            }
+        }
+    }
+}
+
+void execute(Plan& plan, std::vector<std::complex<double>>& a, bool invert) {
+    if (a.size() != plan.n)
+        throw std::invalid_argument("Input length does not match FFT plan length.");
+    if (plan.n < 2) return;
+
+    switch (plan.engine) {
+        case Engine::Stockham: execute_stockham(plan, a.data(), invert);     break;
+        case Engine::Codelet:  execute_codelet(plan, a.data(), invert);      break;
+        default:               execute_cooley_tukey(plan, a.data(), invert); break;
+    }
 
-    // scale for inverse
     if (invert) {
-        for (auto& x : a) x /= double(n);
+        for (auto& x : a) x /= double(plan.n);
     }
 }
 
 // ————————————————————————————————————————————————————————————————
-// Internal 1D FFT on power‑of‑two length (by value)
+// Real‑to‑complex 1D transform via a half‑length complex FFT
 // ————————————————————————————————————————————————————————————————
-static std::vector<std::complex<double>>
-fft1d(std::vector<std::complex<double>> a, bool invert) {
-    fft(a, invert);
-    return a;
+RealPlan make_real_plan(std::size_t n, Engine engine) {
+    if (n < 2 || (n & (n - 1)) != 0)
+        throw std::invalid_argument("Real FFT plan length must be a power of two >= 2.");
+
+    RealPlan p;
+    p.n    = n;
+    p.half = make_plan(n / 2, engine);
+    p.twiddles.resize(n / 2);
+    for (std::size_t k = 0; k < n / 2; ++k) {
+        double ang = -2 * M_PI * double(k) / double(n);
+        p.twiddles[k] = { std::cos(ang), std::sin(ang) };
+    }
+    p.packed.resize(n / 2);
+    return p;
+}
+
+void execute_r2c(RealPlan& plan, const double* in, std::complex<double>* out) {
+    const std::size_t h = plan.n / 2;
+    std::vector<std::complex<double>>& z = plan.packed;
+
+    // z[k] = x[2k] + i·x[2k+1]
+    for (std::size_t k = 0; k < h; ++k)
+        z[k] = { in[2 * k], in[2 * k + 1] };
+    execute(plan.half, z, /*invert=*/false);
+
+    // E[k] = (Z[k] + conj Z[h-k]) / 2,  O[k] = (Z[k] - conj Z[h-k]) / 2i,
+    // X[k] = E[k] + W_n^k O[k]
+    out[0] = { z[0].real() + z[0].imag(), 0.0 };
+    out[h] = { z[0].real() - z[0].imag(), 0.0 };
+    const std::complex<double> minus_half_i(0.0, -0.5);
+    for (std::size_t k = 1; k < h; ++k) {
+        const auto zk  = z[k];
+        const auto zc  = std::conj(z[h - k]);
+        const auto e   = 0.5 * (zk + zc);
+        const auto o   = minus_half_i * (zk - zc);
+        out[k] = e + plan.twiddles[k] * o;
+    }
 }
 
 // ————————————————————————————————————————————————————————————————
 // 2D FFT (pads rows×cols to powers of two, then FFT rows and cols)
 // ————————————————————————————————————————————————————————————————
+Fft2dConfig default_fft2d_config() {
+    return Fft2dConfig{ Engine::Codelet, ColumnStrategy::PerColumn, 1, 1 };
+}
+
 std::vector<std::vector<std::complex<double>>>
 fft2d(const std::vector<std::vector<std::complex<double>>>& input,
       bool invert)
+{
+    std::size_t R = input.size();
+    std::size_t C = R ? input[0].size() : 0;
+    return fft2d(input, invert,
+                 wisdom::fft2d_config(next_power_of_two(R), next_power_of_two(C)));
+}
+
+std::vector<std::vector<std::complex<double>>>
+fft2d(const std::vector<std::vector<std::complex<double>>>& input,
+      bool invert,
+      const Fft2dConfig& config)
 {
     std::size_t R = input.size();
     std::size_t C = R ? input[0].size() : 0;
     std::size_t M = next_power_of_two(R);
     std::size_t N = next_power_of_two(C);
 
+    const int threads = std::max(1, config.threads);
+    const std::size_t block =
+        config.columns == ColumnStrategy::Blocked ? std::max<std::size_t>(1, std::min(config.block, N)) : 1;
+    const long long nrows   = static_cast<long long>(M);
+    const long long nblocks = static_cast<long long>((N + block - 1) / block);
+
     // pad to M×N
     std::vector<std::vector<std::complex<double>>> a(
         M, std::vector<std::complex<double>>(N, {0,0}));
@@ -78,16 +300,31 @@ fft2d(const std::vector<std::vector<std::complex<double>>>& input,
         for (std::size_t j = 0; j < C; ++j)
             a[i][j] = input[i][j];
 
-    // FFT rows
-    for (std::size_t i = 0; i < M; ++i)
-        a[i] = fft1d(a[i], invert);
-
-    // FFT cols
-    std::vector<std::complex<double>> tmp(M);
-    for (std::size_t j = 0; j < N; ++j) {
-        for (std::size_t i = 0; i < M; ++i) tmp[i] = a[i][j];
-        tmp = fft1d(tmp, invert);
-        for (std::size_t i = 0; i < M; ++i) a[i][j] = tmp[i];
+    #pragma omp parallel num_threads(threads)
+    {
+        // FFT rows
+        Plan row_plan = make_plan(N, config.engine);
+        #pragma omp for schedule(static)
+        for (long long i = 0; i < nrows; ++i)
+            execute(row_plan, a[i], invert);
+
+        // FFT cols, `block` columns per sweep over the rows
+        Plan col_plan = make_plan(M, config.engine);
+        std::vector<std::vector<std::complex<double>>> tmp(
+            block, std::vector<std::complex<double>>(M));
+        #pragma omp for schedule(static)
+        for (long long b = 0; b < nblocks; ++b) {
+            const std::size_t j0 = std::size_t(b) * block;
+            const std::size_t nj = std::min(block, N - j0);
+            for (std::size_t i = 0; i < M; ++i)
+                for (std::size_t j = 0; j < nj; ++j)
+                    tmp[j][i] = a[i][j0 + j];
+            for (std::size_t j = 0; j < nj; ++j)
+                execute(col_plan, tmp[j], invert);
+            for (std::size_t i = 0; i < M; ++i)
+                for (std::size_t j = 0; j < nj; ++j)
+                    a[i][j0 + j] = tmp[j][i];
+        }
     }
 
     return a;
@@ -0,0 +1,173 @@
+#include "STFT.hpp"
+#include "SignalSource.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <omp.h>
+
+namespace FFT {
+
+// ————————————————————————————————————————————————————————————————
+// Window functions (periodic form: w[k] for k = 0…L-1 over period L)
+// ————————————————————————————————————————————————————————————————
+std::vector<double> make_window(Window w, std::size_t length) {
+    std::vector<double> out(length, 1.0);
+    for (std::size_t k = 0; k < length; ++k) {
+        const double t = 2 * M_PI * double(k) / double(length);
+        switch (w) {
+            case Window::Rectangular: out[k] = 1.0;                                           break;
+            case Window::Hann:        out[k] = 0.5 - 0.5 * std::cos(t);                       break;
+            case Window::Hamming:     out[k] = 0.54 - 0.46 * std::cos(t);                     break;
+            case Window::Blackman:    out[k] = 0.42 - 0.5 * std::cos(t) + 0.08 * std::cos(2 * t); break;
+        }
+    }
+    return out;
+}
+
+Window window_from_name(const std::string& name) {
+    if (name == "rectangular") return Window::Rectangular;
+    if (name == "hann")        return Window::Hann;
+    if (name == "hamming")     return Window::Hamming;
+    if (name == "blackman")    return Window::Blackman;
+    throw std::invalid_argument("Unknown window: " + name);
+}
+
+// ————————————————————————————————————————————————————————————————
+// STFT engine
+// ————————————————————————————————————————————————————————————————
+STFT::STFT(std::vector<double> window,
+           std::size_t hop,
+           std::size_t fft_length,
+           Engine engine,
+           std::size_t batch)
+    : window_(std::move(window)), hop_(hop), n_(fft_length), batch_(batch),
+      buffer_start_(0), next_frame_(0)
+{
+    if (window_.empty() || window_.size() > n_)
+        throw std::invalid_argument("STFT window must be non-empty and no longer than fft_length.");
+    if (hop_ == 0)
+        throw std::invalid_argument("STFT hop must be at least 1.");
+    if (batch_ == 0)
+        throw std::invalid_argument("STFT batch must be at least 1.");
+
+    // make_plan validates the power‑of‑two length
+    const Plan proto = make_plan(n_, engine);
+    const int threads = std::max(1, omp_get_max_threads());
+    plans_.assign(threads, proto);
+    scratch_.assign(threads, std::vector<std::complex<double>>(n_));
+
+    batch_out_.resize(batch_ * bins());
+    frame_bins_.resize(bins());
+    frame_mag_.resize(bins());
+}
+
+void STFT::set_sink(ComplexSink sink) {
+    complex_sink_   = std::move(sink);
+    magnitude_sink_ = nullptr;
+}
+
+void STFT::set_sink(MagnitudeSink sink) {
+    magnitude_sink_ = std::move(sink);
+    complex_sink_   = nullptr;
+}
+
+void STFT::reset() {
+    pending_.clear();
+    buffer_start_ = 0;
+    next_frame_   = 0;
+}
+
+void STFT::push(const double* samples, std::size_t count) {
+    pending_.insert(pending_.end(), samples, samples + count);
+    process_ready_frames();
+}
+
+void STFT::process_ready_frames() {
+    const std::size_t L   = window_.size();
+    const std::size_t end = buffer_start_ + pending_.size();
+
+    // frames f with f·hop + L ≤ end are complete
+    const std::size_t available = end >= L ? (end - L) / hop_ + 1 : 0;
+
+    while (next_frame_ < available) {
+        const std::size_t count = std::min(batch_, available - next_frame_);
+        transform_batch(next_frame_, count);
+        emit_batch(next_frame_, count);
+        next_frame_ += count;
+    }
+
+    // drop samples no future frame can touch
+    const std::size_t keep_from = next_frame_ * hop_;
+    if (keep_from > buffer_start_) {
+        const std::size_t drop = std::min(keep_from - buffer_start_, pending_.size());
+        pending_.erase(pending_.begin(), pending_.begin() + drop);
+        buffer_start_ += drop;
+    }
+}
+
+void STFT::transform_batch(std::size_t first_frame, std::size_t count) {
+    const std::size_t L  = window_.size();
+    const std::size_t nb = bins();
+    const long long   nf = static_cast<long long>(count);
+
+    // the caller may have raised the thread count since construction
+    const std::size_t threads = std::size_t(std::max(1, omp_get_max_threads()));
+    if (plans_.size() < threads) {
+        plans_.resize(threads, plans_.front());
+        scratch_.resize(threads, std::vector<std::complex<double>>(n_));
+    }
+
+    #pragma omp parallel num_threads(int(threads))
+    {
+        const int tid = omp_get_thread_num();
+        Plan& plan = plans_[tid];
+        std::vector<std::complex<double>>& buf = scratch_[tid];
+
+        #pragma omp for schedule(static)
+        for (long long i = 0; i < nf; ++i) {
+            const std::size_t f      = first_frame + std::size_t(i);
+            const double*     frame  = pending_.data() + (f * hop_ - buffer_start_);
+            for (std::size_t k = 0; k < L; ++k)
+                buf[k] = { window_[k] * frame[k], 0.0 };
+            std::fill(buf.begin() + L, buf.end(), std::complex<double>(0.0, 0.0));
+
+            execute(plan, buf, /*invert=*/false);
+            std::copy(buf.begin(), buf.begin() + nb,
+                      batch_out_.begin() + std::size_t(i) * nb);
+        }
+    }
+}
+
+void STFT::emit_batch(std::size_t first_frame, std::size_t count) {
+    const std::size_t nb = bins();
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::complex<double>* row = batch_out_.data() + i * nb;
+        if (complex_sink_) {
+            std::copy(row, row + nb, frame_bins_.begin());
+            complex_sink_(first_frame + i, frame_bins_);
+        } else if (magnitude_sink_) {
+            for (std::size_t k = 0; k < nb; ++k) frame_mag_[k] = std::abs(row[k]);
+            magnitude_sink_(first_frame + i, frame_mag_);
+        }
+    }
+}
+
+// ————————————————————————————————————————————————————————————————
+// File streaming
+// ————————————————————————————————————————————————————————————————
+std::size_t stft_stream_file(const std::string& filename,
+                             STFT& stft,
+                             std::size_t chunk,
+                             const std::string& dataset)
+{
+    SignalSource src(filename, dataset);
+    std::vector<double> buf;
+    std::size_t total = 0;
+    while (src.read(buf, std::max<std::size_t>(chunk, 1)) > 0) {
+        stft.push(buf);
+        total += buf.size();
+    }
+    return total;
+}
+
+} // namespace FFT
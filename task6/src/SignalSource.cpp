@@ -0,0 +1,96 @@
+#include "SignalSource.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include "H5Cpp.h"
+
+namespace FFT {
+
+// ————————————————————————————————————————————————————————————————
+// file extension without the dot ("" if none)
+// ————————————————————————————————————————————————————————————————
+static std::string extension_of(const std::string& filename) {
+    std::size_t pos = filename.find_last_of('.');
+    if (pos == std::string::npos) return "";
+    return filename.substr(pos + 1);
+}
+
+struct SignalSource::Impl {
+    bool          is_h5 = false;
+    std::size_t   size  = 0;
+    std::size_t   pos   = 0;
+    std::ifstream bin;
+    H5::H5File    h5file;
+    H5::DataSet   h5data;
+};
+
+SignalSource::SignalSource(const std::string& filename,
+                           const std::string& dataset)
+    : impl_(new Impl)
+{
+    const std::string ext = extension_of(filename);
+
+    if (ext == "dat") {
+        impl_->bin.open(filename, std::ios::binary | std::ios::ate);
+        if (!impl_->bin.is_open())
+            throw std::runtime_error("Unable to open signal file: " + filename);
+        impl_->size = std::size_t(impl_->bin.tellg()) / sizeof(double);
+        impl_->bin.seekg(0);
+    } else if (ext == "h5") {
+        try {
+            impl_->h5file.openFile(filename, H5F_ACC_RDONLY);
+            impl_->h5data = impl_->h5file.openDataSet(dataset);
+            H5::DataSpace space = impl_->h5data.getSpace();
+            if (space.getSimpleExtentNdims() != 1)
+                throw std::runtime_error("Dataset '" + dataset + "' in " + filename +
+                                         " is not one-dimensional.");
+            hsize_t dims[1];
+            space.getSimpleExtentDims(dims, nullptr);
+            impl_->size  = std::size_t(dims[0]);
+            impl_->is_h5 = true;
+        } catch (const H5::Exception& e) {
+            throw std::runtime_error("Unable to read HDF5 signal " + filename +
+                                     ": " + e.getDetailMsg());
+        }
+    } else {
+        throw std::runtime_error("Unsupported signal file extension: " + filename);
+    }
+}
+
+SignalSource::~SignalSource() = default;
+
+std::size_t SignalSource::size() const { return impl_->size; }
+
+std::size_t SignalSource::remaining() const { return impl_->size - impl_->pos; }
+
+std::size_t SignalSource::read(double* out, std::size_t count) {
+    count = std::min(count, remaining());
+    if (count == 0) return 0;
+
+    if (impl_->is_h5) {
+        try {
+            H5::DataSpace file_space = impl_->h5data.getSpace();
+            hsize_t offset[1] = { hsize_t(impl_->pos) };
+            hsize_t extent[1] = { hsize_t(count) };
+            file_space.selectHyperslab(H5S_SELECT_SET, extent, offset);
+            H5::DataSpace mem_space(1, extent);
+            impl_->h5data.read(out, H5::PredType::NATIVE_DOUBLE, mem_space, file_space);
+        } catch (const H5::Exception& e) {
+            throw std::runtime_error("HDF5 read failed: " + e.getDetailMsg());
+        }
+    } else {
+        impl_->bin.read(reinterpret_cast<char*>(out), count * sizeof(double));
+        if (impl_->bin.gcount() != static_cast<std::streamsize>(count * sizeof(double)))
+            throw std::runtime_error("Binary signal read failed.");
+    }
+
+    impl_->pos += count;
+    return count;
+}
+
+std::size_t SignalSource::read(std::vector<double>& out, std::size_t count) {
+    out.resize(std::min(count, remaining()));
+    return read(out.data(), out.size());
+}
+
+} // namespace FFT
@@ -0,0 +1,168 @@
+#include "Welch.hpp"
+#include "SignalSource.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <omp.h>
+
+namespace FFT {
+
+WelchPSD::WelchPSD(std::vector<double> window,
+                   std::size_t overlap,
+                   double fs,
+                   Engine engine)
+    : window_(std::move(window)), fs_(fs), window_power_(0.0),
+      buffer_start_(0), next_segment_(0)
+{
+    const std::size_t L = window_.size();
+    if (overlap >= L)
+        throw std::invalid_argument("Welch overlap must be smaller than the segment length.");
+    if (!(fs_ > 0.0))
+        throw std::invalid_argument("Welch sampling frequency must be positive.");
+    step_ = L - overlap;
+
+    for (double w : window_) window_power_ += w * w;
+
+    // make_real_plan validates the segment length
+    const RealPlan proto = make_real_plan(L, engine);
+    const int threads = std::max(1, omp_get_max_threads());
+    plans_.assign(threads, proto);
+    segment_.assign(threads, std::vector<double>(L));
+    spectrum_.assign(threads, std::vector<std::complex<double>>(L / 2 + 1));
+    acc_.assign(threads, std::vector<double>(L / 2 + 1, 0.0));
+}
+
+void WelchPSD::reset() {
+    pending_.clear();
+    buffer_start_ = 0;
+    next_segment_ = 0;
+    for (auto& a : acc_) std::fill(a.begin(), a.end(), 0.0);
+}
+
+// Segment s starts at global sample s·step_, i.e. at base + (s·step_ - base_offset).
+void WelchPSD::accumulate(const double* base, std::size_t base_offset,
+                          std::size_t first_segment, std::size_t count)
+{
+    const std::size_t L  = window_.size();
+    const std::size_t nb = L / 2 + 1;
+    const long long   ns = static_cast<long long>(count);
+
+    // the caller may have raised the thread count since construction
+    const std::size_t threads = std::size_t(std::max(1, omp_get_max_threads()));
+    if (plans_.size() < threads) {
+        plans_.resize(threads, plans_.front());
+        segment_.resize(threads, std::vector<double>(L));
+        spectrum_.resize(threads, std::vector<std::complex<double>>(nb));
+        acc_.resize(threads, std::vector<double>(nb, 0.0));
+    }
+
+    #pragma omp parallel num_threads(int(threads))
+    {
+        const int tid = omp_get_thread_num();
+        RealPlan&                          plan = plans_[tid];
+        std::vector<double>&               seg  = segment_[tid];
+        std::vector<std::complex<double>>& X    = spectrum_[tid];
+        std::vector<double>&               acc  = acc_[tid];
+
+        #pragma omp for schedule(static)
+        for (long long i = 0; i < ns; ++i) {
+            const double* x = base + ((first_segment + std::size_t(i)) * step_ - base_offset);
+            for (std::size_t k = 0; k < L; ++k) seg[k] = window_[k] * x[k];
+            execute_r2c(plan, seg.data(), X.data());
+            for (std::size_t k = 0; k < nb; ++k) acc[k] += std::norm(X[k]);
+        }
+    }
+}
+
+void WelchPSD::push(const double* samples, std::size_t count) {
+    const std::size_t L        = window_.size();
+    const std::size_t end_prev = buffer_start_ + pending_.size();
+    const std::size_t end      = end_prev + count;
+
+    // 1) segments that start inside the pending buffer: they need at most
+    //    L-1 new samples, so only that much is appended to the seam copy
+    if (!pending_.empty()) {
+        const std::size_t take = std::min(count, L - 1);
+        std::vector<double> seam(pending_);
+        seam.insert(seam.end(), samples, samples + take);
+        const std::size_t seam_end = end_prev + take;
+
+        std::size_t n = 0;
+        while ((next_segment_ + n) * step_ < end_prev &&
+               (next_segment_ + n) * step_ + L <= seam_end)
+            ++n;
+        if (n > 0) accumulate(seam.data(), buffer_start_, next_segment_, n);
+        next_segment_ += n;
+
+        if (next_segment_ * step_ < end_prev) {
+            // a seam segment is still incomplete: keep everything
+            pending_.insert(pending_.end(), samples, samples + count);
+            const std::size_t drop = next_segment_ * step_ - buffer_start_;
+            pending_.erase(pending_.begin(), pending_.begin() + drop);
+            buffer_start_ += drop;
+            return;
+        }
+    }
+
+    // 2) segments lying entirely inside the new samples, read in place
+    const std::size_t available = end >= L ? (end - L) / step_ + 1 : 0;
+    if (available > next_segment_) {
+        const std::size_t n = available - next_segment_;
+        accumulate(samples, end_prev, next_segment_, n);
+        next_segment_ += n;
+    }
+
+    // 3) keep the tail the next segment will start in
+    const std::size_t keep_from = std::min(next_segment_ * step_, end);
+    pending_.assign(samples + (keep_from - end_prev), samples + count);
+    buffer_start_ = keep_from;
+}
+
+std::vector<double> WelchPSD::psd() const {
+    const std::size_t nb = window_.size() / 2 + 1;
+    std::vector<double> p(nb, 0.0);
+    if (next_segment_ == 0) return p;
+
+    for (const auto& a : acc_)
+        for (std::size_t k = 0; k < nb; ++k) p[k] += a[k];
+
+    const double scale = 1.0 / (double(next_segment_) * fs_ * window_power_);
+    for (std::size_t k = 0; k < nb; ++k) {
+        const bool edge = (k == 0 || k == nb - 1);
+        p[k] *= (edge ? 1.0 : 2.0) * scale;
+    }
+    return p;
+}
+
+std::vector<double> WelchPSD::frequencies() const {
+    const std::size_t L = window_.size();
+    std::vector<double> f(L / 2 + 1);
+    for (std::size_t k = 0; k < f.size(); ++k) f[k] = double(k) * fs_ / double(L);
+    return f;
+}
+
+std::vector<double> welch_psd(const std::vector<double>& x,
+                              const std::vector<double>& window,
+                              std::size_t overlap,
+                              double fs)
+{
+    WelchPSD welch(window, overlap, fs);
+    welch.push(x);
+    return welch.psd();
+}
+
+std::size_t welch_stream_file(const std::string& filename,
+                              WelchPSD& welch,
+                              std::size_t chunk,
+                              const std::string& dataset)
+{
+    SignalSource src(filename, dataset);
+    std::vector<double> buf;
+    std::size_t total = 0;
+    while (src.read(buf, std::max<std::size_t>(chunk, 1)) > 0) {
+        welch.push(buf);
+        total += buf.size();
+    }
+    return total;
+}
+
+} // namespace FFT
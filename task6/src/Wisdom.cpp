@@ -0,0 +1,268 @@
+#include "Wisdom.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <omp.h>
+
+namespace FFT {
+namespace wisdom {
+
+// Below this many elements the configuration makes no measurable difference.
+static const std::size_t kMinTuneElements = 64 * 64;
+
+// ————————————————————————————————————————————————————————————————
+// Process‑wide wisdom state
+// ————————————————————————————————————————————————————————————————
+struct State {
+    std::mutex mutex;
+    std::map<std::pair<std::size_t, std::size_t>, Fft2dConfig> table;
+    std::set<std::pair<std::size_t, std::size_t>> tuning;   // sizes being tuned now
+    std::condition_variable tuned;                          // signalled when one finishes
+    std::string file;
+    bool autotune;
+    bool loaded;
+
+    State() : loaded(false) {
+        const char* f = std::getenv("FFT_WISDOM_FILE");
+        file = f ? f : "fft_wisdom.txt";
+        const char* a = std::getenv("FFT_WISDOM_AUTOTUNE");
+        autotune = !(a && std::string(a) == "0");
+    }
+};
+
+static State& state() {
+    static State s;
+    return s;
+}
+
+// ————————————————————————————————————————————————————————————————
+// Text conversions
+// ————————————————————————————————————————————————————————————————
+static const char* engine_name(Engine e) {
+    switch (e) {
+        case Engine::Stockham: return "stockham";
+        case Engine::Codelet:  return "codelet";
+        default:               return "cooley_tukey";
+    }
+}
+
+static bool parse_engine(const std::string& s, Engine& e) {
+    if (s == "cooley_tukey") { e = Engine::CooleyTukey; return true; }
+    if (s == "stockham")     { e = Engine::Stockham;    return true; }
+    if (s == "codelet")      { e = Engine::Codelet;     return true; }
+    return false;
+}
+
+static const char* columns_name(ColumnStrategy c) {
+    return c == ColumnStrategy::Blocked ? "blocked" : "per_column";
+}
+
+static bool parse_columns(const std::string& s, ColumnStrategy& c) {
+    if (s == "per_column") { c = ColumnStrategy::PerColumn; return true; }
+    if (s == "blocked")    { c = ColumnStrategy::Blocked;   return true; }
+    return false;
+}
+
+std::string to_string(const Fft2dConfig& c) {
+    std::ostringstream os;
+    os << engine_name(c.engine) << " " << columns_name(c.columns) << " "
+       << c.block << " " << c.threads;
+    return os.str();
+}
+
+// ————————————————————————————————————————————————————————————————
+// Table access and persistence
+// ————————————————————————————————————————————————————————————————
+static bool load_locked(State& s, const std::string& path) {
+    std::ifstream in(path);
+    if (!in.is_open()) return false;
+
+    s.table.clear();
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream is(line);
+        std::string tag, engine, columns;
+        std::size_t M, N;
+        Fft2dConfig c;
+        if (!(is >> tag >> M >> N >> engine >> columns >> c.block >> c.threads)) continue;
+        if (tag != "fft2d" || !parse_engine(engine, c.engine) ||
+            !parse_columns(columns, c.columns) || c.threads < 1) continue;
+        s.table[std::make_pair(M, N)] = c;
+    }
+    return true;
+}
+
+static bool save_locked(const State& s, const std::string& path) {
+    std::ofstream out(path);
+    if (!out.is_open()) return false;
+    for (const auto& kv : s.table)
+        out << "fft2d " << kv.first.first << " " << kv.first.second << " "
+            << to_string(kv.second) << "\n";
+    return bool(out);
+}
+
+// load the wisdom file the first time any entry is needed
+static void ensure_loaded_locked(State& s) {
+    if (s.loaded) return;
+    s.loaded = true;
+    load_locked(s, s.file);
+}
+
+void record(std::size_t M, std::size_t N, const Fft2dConfig& config) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    ensure_loaded_locked(s);
+    s.table[std::make_pair(M, N)] = config;
+}
+
+bool lookup(std::size_t M, std::size_t N, Fft2dConfig& config) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    ensure_loaded_locked(s);
+    auto it = s.table.find(std::make_pair(M, N));
+    if (it == s.table.end()) return false;
+    config = it->second;
+    return true;
+}
+
+bool load(const std::string& path) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.loaded = true;
+    return load_locked(s, path);
+}
+
+bool save(const std::string& path) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return save_locked(s, path);
+}
+
+std::string file() {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return s.file;
+}
+
+void set_file(const std::string& path) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.file   = path;
+    s.loaded = false;
+}
+
+void set_autotune(bool enabled) {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.autotune = enabled;
+}
+
+bool autotune() {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return s.autotune;
+}
+
+void forget() {
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.table.clear();
+    s.loaded = true;
+}
+
+// ————————————————————————————————————————————————————————————————
+// Tuning
+// ————————————————————————————————————————————————————————————————
+std::vector<Fft2dConfig> fft2d_candidates(std::size_t /*M*/, std::size_t N) {
+    const Engine engines[] = { Engine::CooleyTukey, Engine::Stockham, Engine::Codelet };
+    const std::size_t blocks[] = { 1, 8, 32 };
+
+    std::vector<int> threads{1};
+    const int max_threads = omp_get_max_threads();
+    if (max_threads > 1) threads.push_back(max_threads);
+
+    std::vector<Fft2dConfig> out;
+    for (Engine e : engines)
+        for (std::size_t b : blocks) {
+            if (b > 1 && b > N) continue;
+            const ColumnStrategy cs = b == 1 ? ColumnStrategy::PerColumn : ColumnStrategy::Blocked;
+            for (int t : threads)
+                out.push_back(Fft2dConfig{ e, cs, b, t });
+        }
+    return out;
+}
+
+std::vector<Timing> tune_fft2d(std::size_t M, std::size_t N) {
+    std::vector<std::vector<std::complex<double>>> input(
+        M, std::vector<std::complex<double>>(N));
+    for (std::size_t i = 0; i < M; ++i)
+        for (std::size_t j = 0; j < N; ++j)
+            input[i][j] = { std::sin(0.1 * double(i + 3 * j)), std::cos(0.07 * double(i * j)) };
+
+    // best of a few runs for small sizes, one run once it is expensive
+    const int reps = M * N < (std::size_t(1) << 16) ? 3 : 1;
+
+    std::vector<Timing> timings;
+    for (const Fft2dConfig& c : fft2d_candidates(M, N)) {
+        double best = 1e300;
+        for (int r = 0; r < reps; ++r) {
+            auto t0 = std::chrono::high_resolution_clock::now();
+            auto out = fft2d(input, /*invert=*/false, c);
+            auto t1 = std::chrono::high_resolution_clock::now();
+            best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+        }
+        timings.push_back(Timing{ c, best });
+    }
+    std::sort(timings.begin(), timings.end(),
+              [](const Timing& a, const Timing& b) { return a.seconds < b.seconds; });
+
+    State& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    ensure_loaded_locked(s);
+    s.table[std::make_pair(M, N)] = timings.front().config;
+    save_locked(s, s.file);   // best effort: wisdom stays in memory if not writable
+    return timings;
+}
+
+Fft2dConfig fft2d_config(std::size_t M, std::size_t N) {
+    State& s = state();
+    const auto key = std::make_pair(M, N);
+    {
+        // one thread tunes a size; concurrent callers wait for its entry
+        std::unique_lock<std::mutex> lock(s.mutex);
+        ensure_loaded_locked(s);
+        for (;;) {
+            auto it = s.table.find(key);
+            if (it != s.table.end()) return it->second;
+            if (!s.autotune || M * N < kMinTuneElements) return default_fft2d_config();
+            if (s.tuning.count(key) == 0) break;
+            s.tuned.wait(lock);
+        }
+        s.tuning.insert(key);
+    }
+
+    Fft2dConfig c;
+    try {
+        c = tune_fft2d(M, N).front().config;
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.tuning.erase(key);
+        s.tuned.notify_all();
+        throw;
+    }
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.tuning.erase(key);
+    s.tuned.notify_all();
+    return c;
+}
+
+} // namespace wisdom
+} // namespace FFT
@@ -0,0 +1,57 @@
+// src/bench_fft_engines.cpp
+//
+// Times the in‑place Cooley–Tukey engine against the Stockham autosort
+// engine for n = 2^min_log2 … 2^max_log2 and prints one CSV row per size.
+//
+// Usage: run bench_fft_engines [min_log2] [max_log2]
+
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <chrono>
+#include <string>
+#include <algorithm>
+#include "FFT.hpp"
+
+// best‑of time in seconds for one forward transform
+static double time_engine(FFT::Engine engine,
+                          const std::vector<std::complex<double>>& input,
+                          int reps)
+{
+    auto plan = FFT::make_plan(input.size(), engine);
+    std::vector<std::complex<double>> buf;
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        buf = input;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        FFT::execute(plan, buf, /*invert=*/false);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    int min_log2 = 4, max_log2 = 22;
+    if (argc >= 3) {
+        min_log2 = std::stoi(argv[1]);
+        max_log2 = std::stoi(argv[2]);
+    }
+
+    std::cout << "n,cooley_tukey_s,stockham_s,speedup\n";
+    for (int lg = min_log2; lg <= max_log2; ++lg) {
+        const std::size_t n = std::size_t(1) << lg;
+        std::vector<std::complex<double>> input(n);
+        for (std::size_t i = 0; i < n; ++i)
+            input[i] = { double(i % 17) - 8.0, double(i % 5) };
+
+        // fewer repetitions for the large, memory‑bound sizes
+        const int reps = std::max(3, int((std::size_t(1) << 20) / n));
+        double t_ct = time_engine(FFT::Engine::CooleyTukey, input, reps);
+        double t_st = time_engine(FFT::Engine::Stockham,    input, reps);
+
+        std::cout << n << "," << t_ct << "," << t_st << ","
+                  << t_ct / t_st << "\n";
+    }
+    return 0;
+}
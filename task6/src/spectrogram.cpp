@@ -0,0 +1,70 @@
+// src/spectrogram.cpp
+//
+// Streams a real signal from a ".dat" or ".h5" file through the STFT engine
+// and writes the frames, one after the other, to a binary output file
+// (magnitude: nbins doubles per frame; complex: nbins interleaved re/im pairs).
+//
+// Usage:
+//   run spectrogram <input.dat|h5> <output.dat>
+//                   [fft_length=1024] [hop=256] [window=hann] [magnitude|complex]
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <complex>
+#include <stdexcept>
+#include "STFT.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <input.dat|h5> <output.dat> [fft_length] [hop] [window] [magnitude|complex]\n";
+        return 1;
+    }
+    const std::string input  = argv[1];
+    const std::string output = argv[2];
+    std::size_t fft_length   = argc > 3 ? std::stoul(argv[3]) : 1024;
+    std::size_t hop          = argc > 4 ? std::stoul(argv[4]) : 256;
+    std::string window_name  = argc > 5 ? argv[5] : "hann";
+    std::string mode         = argc > 6 ? argv[6] : "magnitude";
+
+    std::ofstream out(output, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "Error: Could not open file " << output << " for writing.\n";
+        return 1;
+    }
+
+    try {
+        auto window = FFT::make_window(FFT::window_from_name(window_name), fft_length);
+        FFT::STFT stft(window, hop, fft_length);
+
+        if (mode == "complex") {
+            stft.set_sink(FFT::STFT::ComplexSink(
+                [&out](std::size_t, const std::vector<std::complex<double>>& bins) {
+                    out.write(reinterpret_cast<const char*>(bins.data()),
+                              bins.size() * sizeof(std::complex<double>));
+                }));
+        } else if (mode == "magnitude") {
+            stft.set_sink(FFT::STFT::MagnitudeSink(
+                [&out](std::size_t, const std::vector<double>& mags) {
+                    out.write(reinterpret_cast<const char*>(mags.data()),
+                              mags.size() * sizeof(double));
+                }));
+        } else {
+            std::cerr << "Unsupported output mode: " << mode << "\n";
+            return 1;
+        }
+
+        std::size_t samples = FFT::stft_stream_file(input, stft);
+
+        std::cout << "Samples read:   " << samples << "\n"
+                  << "Frames written: " << stft.frames_emitted()
+                  << " × " << stft.bins() << " bins (" << mode << ")\n"
+                  << "Output saved to " << output << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,40 @@
+// src/tune_fft2d.cpp
+//
+// Measures every fft2d candidate configuration for the given padded sizes,
+// prints the timings and stores the winners in the wisdom file, so later
+// runs of fft2d (and of everything built on it) use them directly.
+//
+// Usage: run tune_fft2d <M>x<N> [<M>x<N> ...]
+
+#include <iostream>
+#include <string>
+#include "FFT.hpp"
+#include "Wisdom.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <M>x<N> [<M>x<N> ...]\n";
+        return 1;
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t x = arg.find('x');
+        if (x == std::string::npos) {
+            std::cerr << "Invalid size '" << arg << "', expected <M>x<N>\n";
+            return 1;
+        }
+        const std::size_t M = FFT::next_power_of_two(std::stoul(arg.substr(0, x)));
+        const std::size_t N = FFT::next_power_of_two(std::stoul(arg.substr(x + 1)));
+
+        std::cout << "=== fft2d " << M << "x" << N << " ===\n";
+        auto timings = FFT::wisdom::tune_fft2d(M, N);
+        for (const auto& t : timings)
+            std::cout << "  " << t.seconds << " s   "
+                      << FFT::wisdom::to_string(t.config) << "\n";
+        std::cout << "  → " << FFT::wisdom::to_string(timings.front().config) << "\n\n";
+    }
+
+    std::cout << "Wisdom saved to " << FFT::wisdom::file() << "\n";
+    return 0;
+}
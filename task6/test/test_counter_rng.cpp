@@ -0,0 +1,75 @@
+// test/test_counter_rng.cpp
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <omp.h>
+#include "CounterRNG.hpp"
+#include "Task06Helpers.hpp"
+
+int main() {
+    using std::vector;
+    const std::uint64_t seed = 20240601;
+    const size_t n = 100003;
+
+    // 1) reference: one serial fill of the whole range
+    vector<double> ref(n);
+    omp_set_num_threads(1);
+    CounterRNG::fill_gaussian(ref.data(), 0, n, seed);
+
+    // 2) any thread count gives the same bits
+    for (int t : {2, 3, 7}) {
+        omp_set_num_threads(t);
+        vector<double> v(n);
+        CounterRNG::fill_gaussian(v.data(), 0, n, seed);
+        assert(v == ref);
+    }
+    std::cout << "✔ fill is independent of the thread count\n";
+
+    // 3) disjoint ranges (odd boundaries split a Box–Muller pair) match the whole fill
+    {
+        const size_t cuts[] = { 0, 1, 2, 255, 512, 513, 40001, n };
+        vector<double> v(n);
+        for (size_t c = 0; c + 1 < sizeof(cuts) / sizeof(cuts[0]); ++c)
+            CounterRNG::fill_gaussian(v.data() + cuts[c], cuts[c], cuts[c + 1], seed);
+        assert(v == ref);
+
+        double z0, z1;
+        CounterRNG::gaussian_pair(20000, seed, z0, z1);
+        assert(z0 == ref[40000] && z1 == ref[40001]);
+    }
+    std::cout << "✔ independently filled ranges are bitwise identical\n";
+
+    // 4) different seeds give different sequences
+    {
+        vector<double> v(n);
+        CounterRNG::fill_gaussian(v.data(), 0, n, seed + 1);
+        assert(v != ref);
+    }
+
+    // 5) moments of N(0, 1)
+    {
+        double m = 0, q = 0;
+        for (double x : ref) { m += x; q += x * x; }
+        m /= n; q /= n;
+        assert(std::fabs(m) < 5.0 / std::sqrt(double(n)));
+        assert(std::fabs(q - 1.0) < 5.0 * std::sqrt(2.0 / n));
+    }
+    std::cout << "✔ sample mean and variance match N(0, 1)\n";
+
+    // 6) seeded matrix: row‑major slice of the same sequence, with mean/stddev
+    {
+        const size_t M = 37, N = 129;
+        auto A = generate_gaussian_matrix(M, N, 1.0, 1.0, seed);
+        auto B = generate_gaussian_matrix(M, N, 1.0, 1.0, seed);
+        assert(A == B);
+        for (size_t i = 0; i < M; ++i)
+            for (size_t j = 0; j < N; ++j)
+                assert(A[i][j] == 1.0 + ref[i * N + j]);
+    }
+    std::cout << "✔ generate_gaussian_matrix is reproducible for a seed\n";
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+// test/test_error_stats.cpp
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include "Task06Helpers.hpp"
+#include "FFTTestHelpers.hpp"
+
+// reference: full buffer of squares, sort, mean of the two middles if even
+static void reference_stats(const std::vector<double>& e, double& rmse, double& med) {
+    std::vector<double> sq(e.size());
+    for (size_t i = 0; i < e.size(); ++i) sq[i] = e[i] * e[i];
+    double sum = 0;
+    for (double q : sq) sum += q;
+    rmse = std::sqrt(sum / sq.size());
+    std::sort(sq.begin(), sq.end());
+    size_t n = sq.size();
+    med = std::sqrt(n % 2 ? sq[n / 2] : 0.5 * (sq[n / 2 - 1] + sq[n / 2]));
+}
+
+int main() {
+    std::mt19937_64 gen(7);
+    std::normal_distribution<double> dist(1.0, 1.0), noise(0.0, 1e-14);
+
+    for (size_t M : {1, 3, 17}) {
+        for (size_t N : {1, 2, 9, 64}) {
+            std::vector<std::vector<double>> A(M, std::vector<double>(N)), Arec(A);
+            std::vector<std::vector<cd>> Crec(M, std::vector<cd>(N));
+            std::vector<double> ea, er;
+            for (size_t i = 0; i < M; ++i)
+                for (size_t j = 0; j < N; ++j) {
+                    A[i][j] = dist(gen);
+                    // a few exact ties so the median lands on repeated keys
+                    double e = (j % 5 == 0) ? 2e-15 : noise(gen);
+                    Arec[i][j] = A[i][j] + e;
+                    Crec[i][j] = { Arec[i][j], 1.0 };
+                    ea.push_back(Arec[i][j] - A[i][j]);
+                    er.push_back(ea.back() / A[i][j]);
+                }
+
+            double rmse_a, med_a, rmse_r, med_r;
+            reference_stats(ea, rmse_a, med_a);
+            reference_stats(er, rmse_r, med_r);
+
+            for (const ErrorStats& s : { evaluate_r2c_roundtrip(A, Arec),
+                                         evaluate_c2c_roundtrip(A, Crec) }) {
+                assert(approx_eq(s.rmse_abs, rmse_a, 1e-12 * rmse_a));
+                assert(approx_eq(s.rmse_rel, rmse_r, 1e-12 * rmse_r));
+                assert(s.medrse_abs == med_a);
+                assert(s.medrse_rel == med_r);
+            }
+        }
+    }
+    std::cout << "✔ one‑pass error statistics match sort‑based reference\n";
+
+    return 0;
+}
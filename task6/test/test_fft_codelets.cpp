@@ -0,0 +1,50 @@
+// test/test_fft_codelets.cpp
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include "FFT.hpp"
+#include "FFTTestHelpers.hpp"
+
+// O(n²) reference DFT (unnormalized; inverse uses the +i sign)
+static std::vector<std::complex<double>>
+naive_dft(const std::vector<std::complex<double>>& x, bool invert) {
+    const size_t n = x.size();
+    std::vector<std::complex<double>> X(n);
+    for (size_t k = 0; k < n; ++k) {
+        std::complex<double> acc{0,0};
+        for (size_t j = 0; j < n; ++j) {
+            double ang = 2 * M_PI * double((j * k) % n) / double(n) * (invert ? 1 : -1);
+            acc += x[j] * std::complex<double>(std::cos(ang), std::sin(ang));
+        }
+        X[k] = acc;
+    }
+    return X;
+}
+
+int main() {
+    using std::vector;
+    using std::complex;
+
+    // codelet sizes (2…64) and codelet‑based larger transforms (128…512)
+    for (size_t n = 2; n <= 512; n <<= 1) {
+        vector<complex<double>> x(n);
+        for (size_t i = 0; i < n; ++i)
+            x[i] = { std::cos(0.7 * i) + 0.01 * i, std::sin(2.3 * i) };
+
+        vector<complex<double>> fwd = x;
+        FFT::fft(fwd, /*invert=*/false);
+        assert(approx_eq(fwd, naive_dft(x, false), 1e-10 * n));
+
+        vector<complex<double>> inv = x;
+        FFT::fft(inv, /*invert=*/true);
+        auto ref = naive_dft(x, true);
+        for (auto& c : ref) c /= double(n);
+        assert(approx_eq(inv, ref, 1e-10));
+    }
+    std::cout << "✔ fft codelets (n = 2…64) and codelet base case (n = 128…512) match naive DFT\n";
+
+    return 0;
+}
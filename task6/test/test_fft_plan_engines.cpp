@@ -0,0 +1,63 @@
+// test/test_fft_plan_engines.cpp
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <stdexcept>
+#include "FFT.hpp"
+#include "FFTTestHelpers.hpp"
+
+int main() {
+    using std::vector;
+    using std::complex;
+
+    // 1) both engines agree with FFT::fft, for odd and even numbers of passes
+    for (size_t n : {2, 4, 8, 32, 64, 1024}) {
+        vector<complex<double>> ref(n);
+        for (size_t i = 0; i < n; ++i)
+            ref[i] = { std::sin(0.3 * i) + 0.1 * i, std::cos(1.7 * i) };
+
+        vector<complex<double>> ct = ref, st = ref;
+        FFT::fft(ref, /*invert=*/false);
+
+        auto p_ct = FFT::make_plan(n, FFT::Engine::CooleyTukey);
+        auto p_st = FFT::make_plan(n, FFT::Engine::Stockham);
+        FFT::execute(p_ct, ct, /*invert=*/false);
+        FFT::execute(p_st, st, /*invert=*/false);
+
+        assert(approx_eq(ct, ref, 1e-9 * n));
+        assert(approx_eq(st, ref, 1e-9 * n));
+    }
+    std::cout << "✔ plan engines match fft() forward\n";
+
+    // 2) Stockham forward+inverse round‑trip, plan reused
+    {
+        const size_t n = 512;
+        auto plan = FFT::make_plan(n, FFT::Engine::Stockham);
+        vector<complex<double>> orig(n);
+        for (size_t i = 0; i < n; ++i) orig[i] = { double(i % 7), -double(i % 3) };
+        vector<complex<double>> buf = orig;
+        FFT::execute(plan, buf, /*invert=*/false);
+        FFT::execute(plan, buf, /*invert=*/true);
+        assert(approx_eq(buf, orig));
+        std::cout << "✔ Stockham forward+inverse round‑trip\n";
+    }
+
+    // 3) invalid plan length / mismatched input must throw
+    {
+        bool thrown = false;
+        try { FFT::make_plan(12); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+
+        thrown = false;
+        auto plan = FFT::make_plan(8, FFT::Engine::Stockham);
+        vector<complex<double>> v(4);
+        try { FFT::execute(plan, v, false); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        std::cout << "✔ plan argument checks\n";
+    }
+
+    return 0;
+}
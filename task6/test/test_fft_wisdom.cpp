@@ -0,0 +1,92 @@
+// test/test_fft_wisdom.cpp
+
+#include <cassert>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include "FFT.hpp"
+#include "Wisdom.hpp"
+#include "FFTTestHelpers.hpp"
+
+using cmat = std::vector<std::vector<std::complex<double>>>;
+
+static bool approx_eq(const cmat& A, const cmat& B, double tol) {
+    if (A.size() != B.size()) return false;
+    for (size_t i = 0; i < A.size(); ++i)
+        if (!approx_eq(A[i], B[i], tol)) return false;
+    return true;
+}
+
+int main() {
+    const std::string path = "test_fft_wisdom.txt";
+    FFT::wisdom::set_autotune(false);
+    FFT::wisdom::set_file(path);
+    FFT::wisdom::forget();
+
+    // 1) every candidate configuration computes the same transform
+    {
+        cmat A(12, std::vector<std::complex<double>>(40));
+        for (size_t i = 0; i < A.size(); ++i)
+            for (size_t j = 0; j < A[i].size(); ++j)
+                A[i][j] = { std::sin(0.3 * i + j), 0.1 * double(i) - std::cos(0.2 * j) };
+
+        auto ref = FFT::fft2d(A, false, FFT::default_fft2d_config());
+        for (const auto& c : FFT::wisdom::fft2d_candidates(16, 64)) {
+            assert(approx_eq(FFT::fft2d(A, false, c), ref, 1e-9));
+            auto back = FFT::fft2d(FFT::fft2d(A, false, c), true, c);
+            for (size_t i = 0; i < A.size(); ++i)
+                for (size_t j = 0; j < A[i].size(); ++j)
+                    assert(approx_eq(back[i][j], A[i][j]));
+        }
+        std::cout << "✔ all fft2d candidate configurations agree\n";
+    }
+
+    // 2) unknown size without auto‑tuning falls back to the default
+    {
+        auto c = FFT::wisdom::fft2d_config(128, 128);
+        assert(FFT::wisdom::to_string(c) == FFT::wisdom::to_string(FFT::default_fft2d_config()));
+        std::cout << "✔ default configuration without wisdom\n";
+    }
+
+    // 3) tuning records the winner, which survives a save/load round trip
+    {
+        auto timings = FFT::wisdom::tune_fft2d(64, 64);
+        assert(timings.size() == FFT::wisdom::fft2d_candidates(64, 64).size());
+        for (size_t i = 1; i < timings.size(); ++i)
+            assert(timings[i - 1].seconds <= timings[i].seconds);
+
+        FFT::Fft2dConfig stored;
+        assert(FFT::wisdom::lookup(64, 64, stored));
+        const std::string winner = FFT::wisdom::to_string(timings.front().config);
+        assert(FFT::wisdom::to_string(stored) == winner);
+
+        FFT::wisdom::forget();
+        assert(!FFT::wisdom::lookup(64, 64, stored));
+        assert(FFT::wisdom::load(path));
+        assert(FFT::wisdom::lookup(64, 64, stored));
+        assert(FFT::wisdom::to_string(stored) == winner);
+        assert(FFT::wisdom::to_string(FFT::wisdom::fft2d_config(64, 64)) == winner);
+        std::cout << "✔ tuned configuration persisted in wisdom file\n";
+    }
+
+    // 4) concurrent first calls tune once and all get the stored winner
+    {
+        FFT::wisdom::forget();
+        FFT::wisdom::set_autotune(true);
+        std::vector<std::string> got(4);
+        #pragma omp parallel for num_threads(4)
+        for (int t = 0; t < 4; ++t)
+            got[t] = FFT::wisdom::to_string(FFT::wisdom::fft2d_config(64, 128));
+        FFT::wisdom::set_autotune(false);
+
+        FFT::Fft2dConfig stored;
+        assert(FFT::wisdom::lookup(64, 128, stored));
+        for (const auto& g : got) assert(g == FFT::wisdom::to_string(stored));
+        std::cout << "✔ concurrent first calls share one tuning run\n";
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,121 @@
+// test/test_stft.cpp
+
+#include <cassert>
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <stdexcept>
+#include <omp.h>
+#include "H5Cpp.h"
+#include "STFT.hpp"
+#include "FFTTestHelpers.hpp"
+
+using cvec = std::vector<std::complex<double>>;
+
+// collect all complex frames of a signal pushed in pieces of `piece` samples
+static std::vector<cvec> run_stft(FFT::STFT& stft, const std::vector<double>& x, size_t piece) {
+    std::vector<cvec> frames;
+    stft.reset();
+    stft.set_sink(FFT::STFT::ComplexSink(
+        [&frames](size_t f, const cvec& bins) {
+            assert(f == frames.size());
+            frames.push_back(bins);
+        }));
+    for (size_t i = 0; i < x.size(); i += piece)
+        stft.push(x.data() + i, std::min(piece, x.size() - i));
+    return frames;
+}
+
+int main() {
+    const size_t n = 64, L = 48, hop = 20, len = 1000;
+    std::vector<double> x(len);
+    for (size_t i = 0; i < len; ++i)
+        x[i] = std::sin(0.05 * i * i / len) + 0.3 * std::cos(1.1 * i);
+
+    auto window = FFT::make_window(FFT::Window::Hann, L);
+    FFT::STFT stft(window, hop, n, FFT::Engine::Stockham, /*batch=*/7);
+
+    // 1) frames match a direct windowed, zero‑padded FFT
+    auto frames = run_stft(stft, x, len);
+    assert(frames.size() == (len - L) / hop + 1);
+    for (size_t f = 0; f < frames.size(); ++f) {
+        cvec ref(n, {0, 0});
+        for (size_t k = 0; k < L; ++k) ref[k] = window[k] * x[f * hop + k];
+        FFT::fft(ref, /*invert=*/false);
+        ref.resize(n / 2 + 1);
+        assert(approx_eq(frames[f], ref, 1e-10));
+    }
+    std::cout << "✔ STFT frames match direct FFT of each window\n";
+
+    // 2) result independent of how the input is chunked
+    for (size_t piece : {1, 13, 64, 333})
+        assert(run_stft(stft, x, piece) == frames);
+    std::cout << "✔ STFT streaming is chunk‑size independent\n";
+
+    // 3) magnitude sink
+    {
+        std::vector<double> mag0;
+        stft.reset();
+        stft.set_sink(FFT::STFT::MagnitudeSink(
+            [&mag0](size_t f, const std::vector<double>& m) { if (f == 0) mag0 = m; }));
+        stft.push(x);
+        assert(mag0.size() == n / 2 + 1);
+        for (size_t k = 0; k < mag0.size(); ++k)
+            assert(approx_eq(mag0[k], std::abs(frames[0][k])));
+        std::cout << "✔ STFT magnitude frames\n";
+    }
+
+    // 4) streaming from .dat and .h5 files
+    {
+        const std::string dat = "test_stft_signal.dat", h5 = "test_stft_signal.h5";
+        {
+            std::ofstream out(dat, std::ios::binary);
+            out.write(reinterpret_cast<const char*>(x.data()), x.size() * sizeof(double));
+        }
+        {
+            H5::H5File file(h5, H5F_ACC_TRUNC);
+            hsize_t dims[1] = { len };
+            H5::DataSpace space(1, dims);
+            H5::DataSet ds = file.createDataSet("signal", H5::PredType::NATIVE_DOUBLE, space);
+            ds.write(x.data(), H5::PredType::NATIVE_DOUBLE);
+        }
+        for (const std::string& file : {dat, h5}) {
+            std::vector<cvec> got;
+            stft.reset();
+            stft.set_sink(FFT::STFT::ComplexSink(
+                [&got](size_t, const cvec& bins) { got.push_back(bins); }));
+            assert(FFT::stft_stream_file(file, stft, /*chunk=*/97) == len);
+            assert(got == frames);
+        }
+        std::remove(dat.c_str());
+        std::remove(h5.c_str());
+        std::cout << "✔ STFT streams .dat and .h5 input in chunks\n";
+    }
+
+    // 5) invalid configuration must throw
+    {
+        bool thrown = false;
+        try { FFT::STFT bad(window, hop, 32); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { FFT::STFT bad(window, 0, n); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        std::cout << "✔ STFT argument checks\n";
+    }
+
+    // 6) more threads than at construction
+    {
+        const int saved = omp_get_max_threads();
+        omp_set_num_threads(1);
+        FFT::STFT small(window, hop, n, FFT::Engine::Stockham, /*batch=*/7);
+        omp_set_num_threads(4);
+        assert(run_stft(small, x, 333) == frames);
+        omp_set_num_threads(saved);
+        std::cout << "✔ STFT handles a thread count raised after construction\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+// test/test_welch.cpp
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <omp.h>
+#include "FFT.hpp"
+#include "STFT.hpp"
+#include "Welch.hpp"
+#include "FFTTestHelpers.hpp"
+
+int main() {
+    using std::vector;
+    using std::complex;
+
+    // 1) r2c plan matches the complex FFT on the non‑negative bins
+    for (size_t n : {2, 4, 16, 128, 1024}) {
+        vector<double> x(n);
+        for (size_t i = 0; i < n; ++i) x[i] = std::sin(0.37 * i) + 0.05 * i;
+        vector<complex<double>> ref(x.begin(), x.end());
+        FFT::fft(ref, /*invert=*/false);
+        ref.resize(n / 2 + 1);
+
+        auto plan = FFT::make_real_plan(n, FFT::Engine::Stockham);
+        vector<complex<double>> out(n / 2 + 1);
+        FFT::execute_r2c(plan, x.data(), out.data());
+        assert(approx_eq(out, ref, 1e-10 * n));
+    }
+    std::cout << "✔ r2c plan matches complex FFT\n";
+
+    const size_t L = 64, overlap = 40, len = 5000;
+    const double fs = 8.0;
+    vector<double> x(len);
+    std::mt19937_64 gen(42);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    for (size_t i = 0; i < len; ++i) x[i] = std::cos(0.9 * i) + noise(gen);
+    auto window = FFT::make_window(FFT::Window::Hann, L);
+
+    // 2) matches a direct per‑segment computation
+    vector<double> psd = FFT::welch_psd(x, window, overlap, fs);
+    {
+        const size_t step = L - overlap, nseg = (len - L) / step + 1;
+        double wpow = 0;
+        for (double w : window) wpow += w * w;
+        vector<double> ref(L / 2 + 1, 0.0);
+        for (size_t s = 0; s < nseg; ++s) {
+            vector<complex<double>> seg(L);
+            for (size_t k = 0; k < L; ++k) seg[k] = window[k] * x[s * step + k];
+            FFT::fft(seg, false);
+            for (size_t k = 0; k <= L / 2; ++k) ref[k] += std::norm(seg[k]);
+        }
+        for (size_t k = 0; k <= L / 2; ++k) {
+            ref[k] *= (k == 0 || k == L / 2 ? 1.0 : 2.0) / (nseg * fs * wpow);
+            assert(approx_eq(psd[k], ref[k], 1e-9 * (1 + ref[k])));
+        }
+    }
+    std::cout << "✔ Welch PSD matches direct segment averaging\n";
+
+    // 3) streaming in arbitrary pieces gives the same estimate
+    for (size_t piece : {1, 7, 63, 64, 65, 1000}) {
+        FFT::WelchPSD welch(window, overlap, fs);
+        for (size_t i = 0; i < len; i += piece)
+            welch.push(x.data() + i, std::min(piece, len - i));
+        auto p = welch.psd();
+        for (size_t k = 0; k < p.size(); ++k)
+            assert(approx_eq(p[k], psd[k], 1e-12 * (1 + psd[k])));
+    }
+    std::cout << "✔ Welch PSD is chunk‑size independent\n";
+
+    // 4) white noise: ∫ PSD df ≈ variance
+    {
+        vector<double> w(1 << 16);
+        for (auto& v : w) v = 2.0 * noise(gen);
+        auto rect = FFT::make_window(FFT::Window::Rectangular, 256);
+        FFT::WelchPSD welch(rect, 128, fs);
+        welch.push(w);
+        auto p = welch.psd();
+        double power = 0;
+        for (double v : p) power += v * fs / 256;
+        assert(std::fabs(power - 4.0) < 0.2);
+    }
+    std::cout << "✔ Welch PSD integrates to the signal variance\n";
+
+    // 5) invalid configuration must throw
+    {
+        bool thrown = false;
+        try { FFT::WelchPSD bad(window, L); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { FFT::WelchPSD bad(vector<double>(48, 1.0), 0); } catch (const std::invalid_argument&) { thrown = true; }
+        assert(thrown);
+        std::cout << "✔ Welch argument checks\n";
+    }
+
+    // 6) more threads than at construction
+    {
+        const int saved = omp_get_max_threads();
+        omp_set_num_threads(1);
+        FFT::WelchPSD welch(window, overlap, fs);
+        welch.push(x.data(), len / 2);
+        omp_set_num_threads(4);
+        welch.push(x.data() + len / 2, len - len / 2);
+        omp_set_num_threads(saved);
+        auto p = welch.psd();
+        for (size_t k = 0; k < p.size(); ++k)
+            assert(approx_eq(p[k], psd[k], 1e-12 * (1 + psd[k])));
+        std::cout << "✔ Welch handles a thread count raised after construction\n";
+    }
+
+    return 0;
+}
@@ -4,6 +4,35 @@
 #include <vector>
 #include <stdexcept>
 #include <cstddef>
+#include "aligned_buffer.hpp"
+#include "vector_sum_stream.hpp"
+
+/**
+ * @brief Compute d[i] = a * x[i] + y[i] for i < n on raw buffers.
+ *
+ * Works on any contiguous storage (pre-allocated arrays, mmap'd files, slices
+ * of larger vectors) without allocating. d may be the same buffer as y, which
+ * gives the in-place update y += a * x; other overlaps are not supported.
+ *
+ * Out-of-place calls with n ≥ vector_sum_stream_threshold() (working set
+ * larger than the last-level cache) write d with streaming stores, see
+ * vector_sum_stream.hpp; smaller or in-place calls use the plain loop.
+ *
+ * @param a   Scalar multiplier.
+ * @param x   Input x[0..n).
+ * @param y   Input y[0..n).
+ * @param d   Output d[0..n) (may equal y).
+ * @param n   Number of elements.
+ */
+inline void vector_sum(double a, const double* x, const double* y, double* d, std::size_t n) {
+    if (d != y && n >= vector_sum_stream_threshold()) {
+        vector_sum_stream(a, x, y, d, n);
+        return;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        d[i] = a * x[i] + y[i];
+    }
+}
 
 /**
  * @brief Compute the vector sum d = a * x + y.
@@ -11,21 +40,45 @@
  * This function accepts a scalar and two input vectors, and writes the result into
  * the output vector d. It checks that the two input vectors have the same size;
  * if not, it throws an exception. The output vector d is resized to match the input vectors.
+ * With an aligned_vector<double> output the resize does not zero‑fill d, so the
+ * loop below is the first write to it.
  *
  * @param a   Scalar multiplier.
  * @param x   Vector x.
  * @param y   Vector y.
- * @param d   Output vector to store the result.
+ * @param d   Output vector to store the result (std::vector or aligned_vector).
  * @throws std::invalid_argument if the sizes of x and y are not equal.
  */
-inline void vector_sum(double a, const std::vector<double>& x, const std::vector<double>& y, std::vector<double>& d) {
+template <typename Alloc>
+inline void vector_sum(double a, const std::vector<double>& x, const std::vector<double>& y, std::vector<double, Alloc>& d) {
     if (x.size() != y.size()) {
         throw std::invalid_argument("Vectors x and y must have the same size.");
     }
     d.resize(x.size());
-    for (std::size_t i = 0; i < x.size(); ++i) {
-        d[i] = a * x[i] + y[i];
+    vector_sum(a, x.data(), y.data(), d.data(), x.size());
+}
+
+/**
+ * @brief In-place update y = a * x + y.
+ *
+ * Reads x and y and writes y: no third array, and no write-allocate traffic
+ * on a separate output.
+ *
+ * @param a   Scalar multiplier.
+ * @param x   Vector x.
+ * @param y   Vector y, overwritten with the result.
+ * @throws std::invalid_argument if the sizes of x and y are not equal.
+ */
+inline void vector_sum_inplace(double a, const std::vector<double>& x, std::vector<double>& y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Vectors x and y must have the same size.");
     }
+    vector_sum(a, x.data(), y.data(), y.data(), x.size());
+}
+
+/// In-place update y[i] += a * x[i] for i < n on raw buffers.
+inline void vector_sum_inplace(double a, const double* x, double* y, std::size_t n) {
+    vector_sum(a, x, y, y, n);
 }
 
-#endif // VECTOR_SUM_CPP_HPP
\ No newline at end of file
+#endif // VECTOR_SUM_CPP_HPP
@@ -2,6 +2,8 @@
 #include <vector>
 #include <stdexcept>
 #include <cassert>
+#include <cstdint>
+#include <algorithm>
 #include "vector_sum.hpp"
 
 int main() {
@@ -40,6 +42,105 @@ int main() {
         assert(thrown);
     }
 
+    // Test 4: pointer/length overload on a slice
+    {
+        std::vector<double> x{1.0, 2.0, 3.0, 4.0};
+        std::vector<double> y{4.0, 5.0, 6.0, 7.0};
+        std::vector<double> d(2, 0.0);
+        vector_sum(2.0, x.data() + 1, y.data() + 1, d.data(), 2);
+        assert(d[0] == 9.0);
+        assert(d[1] == 12.0);
+    }
+
+    // Test 5: in-place update y = a*x + y matches the out-of-place result
+    {
+        double a = -0.5;
+        std::vector<double> x{1.0, 2.0, 3.0};
+        std::vector<double> y{4.0, 5.0, 6.0};
+        std::vector<double> d;
+        vector_sum(a, x, y, d);
+        vector_sum_inplace(a, x, y);
+        assert(y == d);
+
+        std::vector<double> z{4.0, 5.0, 6.0};
+        vector_sum_inplace(a, x.data(), z.data(), z.size());
+        assert(z == d);
+    }
+
+    // Test 6: in-place with mismatched sizes must throw
+    {
+        bool thrown = false;
+        std::vector<double> x{1.0};
+        std::vector<double> y{1.0, 2.0};
+        try {
+            vector_sum_inplace(1.0, x, y);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    // Test 7: aligned, non-zero-filled output vector
+    {
+        std::vector<double> x{1.0, 2.0, 3.0, 4.0, 5.0};
+        std::vector<double> y{5.0, 4.0, 3.0, 2.0, 1.0};
+        std::vector<double> d_ref;
+        aligned_vector<double> d;
+        vector_sum(3.0, x, y, d_ref);
+        vector_sum(3.0, x, y, d);
+        assert(d.size() == x.size());
+        assert(reinterpret_cast<std::uintptr_t>(d.data()) % 64 == 0);
+        assert(std::equal(d.begin(), d.end(), d_ref.begin()));
+
+        // values given explicitly are still stored
+        aligned_vector<double> filled(3, 2.5);
+        assert(filled[0] == 2.5 && filled[2] == 2.5);
+    }
+
+    // Test 8: streaming-store kernel, unaligned output and odd length
+    {
+        const std::size_t n = 37;
+        std::vector<double> x(n), y(n), d_ref(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = 0.5 * i;
+            y[i] = 3.0 - i;
+        }
+        for (std::size_t i = 0; i < n; ++i) d_ref[i] = -1.25 * x[i] + y[i];
+
+        aligned_vector<double> buf(n + 1);
+        vector_sum_stream(-1.25, x.data(), y.data(), buf.data() + 1, n);
+        assert(std::equal(buf.begin() + 1, buf.end(), d_ref.begin()));
+    }
+
+    // Test 9: streaming dispatch: vector_sum above a forced streaming threshold
+    {
+        const std::size_t n = 37;
+        std::vector<double> x(n), y(n), d_ref(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = 0.25 * i;
+            y[i] = 1.0 + i;
+        }
+        for (std::size_t i = 0; i < n; ++i) d_ref[i] = 0.75 * x[i] + y[i];
+
+        const std::size_t saved = vector_sum_stream_threshold();
+        set_vector_sum_stream_threshold(16);
+
+        aligned_vector<double> buf(n + 1);
+        vector_sum(0.75, x.data(), y.data(), buf.data() + 1, n);
+        assert(std::equal(buf.begin() + 1, buf.end(), d_ref.begin()));
+
+        std::vector<double> d;
+        vector_sum(0.75, x, y, d);
+        assert(d == d_ref);
+
+        // in-place calls keep ordinary stores and give the same result
+        vector_sum_inplace(0.75, x, y);
+        assert(y == d_ref);
+
+        set_vector_sum_stream_threshold(saved);
+        assert(vector_sum_stream_threshold() == saved);
+    }
+
     std::cout << "All vector_sum tests passed.\n";
     return 0;
 }
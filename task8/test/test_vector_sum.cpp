@@ -4,6 +4,8 @@
 #include <numeric>
 #include <cmath>
 #include <stdexcept>
+#include <cstdint>
+#include <algorithm>
 
 #include "vector_sum.hpp"
 #include "vector_sum_chunked.hpp"
@@ -84,6 +86,97 @@ int main() {
         assert(caught);
     }
 
+    // 6) pointer/length overload and in-place update match the vector version
+    {
+        double a = 0.5;
+        std::vector<double> x{1,2,3,4,5,6,7};
+        std::vector<double> y{7,6,5,4,3,2,1};
+        std::vector<double> d_ref, partial_ref, partial;
+
+        vector_sum_chunked(a, x, y, d_ref, /*chunk_size=*/3, partial_ref);
+
+        std::vector<double> d(x.size());
+        vector_sum_chunked(a, x.data(), y.data(), d.data(), x.size(), /*chunk_size=*/3, partial);
+        assert(d == d_ref);
+        assert(partial == partial_ref);
+
+        vector_sum_chunked_inplace(a, x, y, /*chunk_size=*/3, partial);
+        assert(y == d_ref);
+        assert(partial == partial_ref);
+    }
+
+    // 7) in-place with mismatched sizes must throw
+    {
+        bool caught = false;
+        std::vector<double> x{1}, y{1,2}, partial;
+        try {
+            vector_sum_chunked_inplace(1.0, x, y, /*chunk_size=*/2, partial);
+        } catch (const std::invalid_argument&) {
+            caught = true;
+        }
+        assert(caught);
+    }
+
+    // 8) aligned, non-zero-filled output vector
+    {
+        double a = 1.5;
+        std::vector<double> x{0,1,2,3,4,5,6};
+        std::vector<double> y{6,5,4,3,2,1,0};
+        std::vector<double> d_ref, partial_ref, partial;
+        aligned_vector<double> d;
+
+        vector_sum_chunked(a, x, y, d_ref, /*chunk_size=*/4, partial_ref);
+        vector_sum_chunked(a, x, y, d, /*chunk_size=*/4, partial);
+        assert(reinterpret_cast<std::uintptr_t>(d.data()) % 64 == 0);
+        assert(d.size() == d_ref.size());
+        assert(std::equal(d.begin(), d.end(), d_ref.begin()));
+        assert(partial == partial_ref);
+    }
+
+    // 9) streaming-store kernel, unaligned output and odd length
+    {
+        const std::size_t n = 37;
+        std::vector<double> x(n), y(n), d_ref(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = 0.5 * i;
+            y[i] = 3.0 - i;
+        }
+        for (std::size_t i = 0; i < n; ++i) d_ref[i] = -1.25 * x[i] + y[i];
+
+        aligned_vector<double> buf(n + 1);
+        vector_sum_stream(-1.25, x.data(), y.data(), buf.data() + 1, n);
+        assert(std::equal(buf.begin() + 1, buf.end(), d_ref.begin()));
+    }
+
+    // 10) streaming dispatch: vector_sum above a forced streaming threshold
+    {
+        const std::size_t n = 37;
+        std::vector<double> x(n), y(n), d_ref(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = 0.25 * i;
+            y[i] = 1.0 + i;
+        }
+        for (std::size_t i = 0; i < n; ++i) d_ref[i] = 0.75 * x[i] + y[i];
+
+        const std::size_t saved = vector_sum_stream_threshold();
+        set_vector_sum_stream_threshold(16);
+
+        aligned_vector<double> buf(n + 1);
+        vector_sum(0.75, x.data(), y.data(), buf.data() + 1, n);
+        assert(std::equal(buf.begin() + 1, buf.end(), d_ref.begin()));
+
+        std::vector<double> d;
+        vector_sum(0.75, x, y, d);
+        assert(d == d_ref);
+
+        // in-place calls keep ordinary stores and give the same result
+        vector_sum_inplace(0.75, x, y);
+        assert(y == d_ref);
+
+        set_vector_sum_stream_threshold(saved);
+        assert(vector_sum_stream_threshold() == saved);
+    }
+
     std::cout << "All chunked-vector_sum tests passed.\n";
     return 0;
 }
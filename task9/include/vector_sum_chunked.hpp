@@ -5,42 +5,39 @@
 #include <stdexcept>
 #include <cstddef>
 #include <algorithm>
+#include "aligned_buffer.hpp"
 
 /**
- * @brief Compute d = a*x + y in fixed‑size chunks and record partial sums.
+ * @brief Compute d = a*x + y on raw buffers in fixed‑size chunks and record partial sums.
  *
  * Splits the work over chunks of length chunk_size.  For each chunk it
  * computes the DAXPY update on d and sums the updated elements into
- * partial_chunk_sum[chunk_index].  The caller can then verify that
- * sum(partial_chunk_sum) equals sum(d).
+ * partial_chunk_sum[chunk_index].  d may be the same buffer as y (in‑place
+ * update y += a*x); other overlaps are not supported.
  *
  * @param a   Scalar multiplier.
- * @param x   Input vector x.
- * @param y   Input vector y.
- * @param d   Output vector (resized to x.size()).
- * @param chunk_size  Number of elements per chunk (must be ≥ 1).
+ * @param x   Input x[0..n).
+ * @param y   Input y[0..n).
+ * @param d   Output d[0..n) (may equal y).
+ * @param n   Number of elements.
+ * @param chunk_size  Number of elements per chunk (must be ≥ 1).
  * @param partial_chunk_sum
- *            Output vector of length ceil(x.size()/chunk_size),
+ *            Output vector of length ceil(n/chunk_size),
  *            where each entry is the sum of d over one chunk.
- * @throws std::invalid_argument if x.size() ≠ y.size() or chunk_size == 0.
+ * @throws std::invalid_argument if chunk_size == 0.
  */
 inline void vector_sum_chunked(double a,
-                               const std::vector<double>& x,
-                               const std::vector<double>& y,
-                               std::vector<double>& d,
+                               const double* x,
+                               const double* y,
+                               double* d,
+                               std::size_t n,
                                std::size_t chunk_size,
                                std::vector<double>& partial_chunk_sum)
 {
-    if (x.size() != y.size()) {
-        throw std::invalid_argument("Vectors x and y must have the same size.");
-    }
     if (chunk_size == 0) {
         throw std::invalid_argument("chunk_size must be at least 1.");
     }
 
-    std::size_t n = x.size();
-    d.resize(n);
-
     // Number of chunks = ceil(n / chunk_size)
     std::size_t num_chunks = (n + chunk_size - 1) / chunk_size;
     partial_chunk_sum.assign(num_chunks, 0.0);
@@ -58,4 +55,54 @@ inline void vector_sum_chunked(double a,
     }
 }
 
+/**
+ * @brief Compute d = a*x + y in fixed‑size chunks and record partial sums.
+ *
+ * The caller can then verify that sum(partial_chunk_sum) equals sum(d).
+ *
+ * @param a   Scalar multiplier.
+ * @param x   Input vector x.
+ * @param y   Input vector y.
+ * @param d   Output vector (resized to x.size(); an aligned_vector is not zero‑filled).
+ * @param chunk_size  Number of elements per chunk (must be ≥ 1).
+ * @param partial_chunk_sum
+ *            Output vector of length ceil(x.size()/chunk_size),
+ *            where each entry is the sum of d over one chunk.
+ * @throws std::invalid_argument if x.size() ≠ y.size() or chunk_size == 0.
+ */
+template <typename Alloc>
+inline void vector_sum_chunked(double a,
+                               const std::vector<double>& x,
+                               const std::vector<double>& y,
+                               std::vector<double, Alloc>& d,
+                               std::size_t chunk_size,
+                               std::vector<double>& partial_chunk_sum)
+{
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Vectors x and y must have the same size.");
+    }
+    if (chunk_size == 0) {
+        throw std::invalid_argument("chunk_size must be at least 1.");
+    }
+    d.resize(x.size());
+    vector_sum_chunked(a, x.data(), y.data(), d.data(), x.size(), chunk_size, partial_chunk_sum);
+}
+
+/**
+ * @brief In‑place chunked update y = a*x + y, with the per‑chunk sums of the new y.
+ *
+ * @throws std::invalid_argument if x.size() ≠ y.size() or chunk_size == 0.
+ */
+inline void vector_sum_chunked_inplace(double a,
+                                       const std::vector<double>& x,
+                                       std::vector<double>& y,
+                                       std::size_t chunk_size,
+                                       std::vector<double>& partial_chunk_sum)
+{
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Vectors x and y must have the same size.");
+    }
+    vector_sum_chunked(a, x.data(), y.data(), y.data(), x.size(), chunk_size, partial_chunk_sum);
+}
+
 #endif // VECTOR_SUM_CHUNKED_HPP
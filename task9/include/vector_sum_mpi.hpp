@@ -4,53 +4,133 @@
 #include <vector>
 #include <stdexcept>
 #include <cstddef>
+#include <algorithm>
 #include <mpi.h>
 
+/**
+ * @brief Split n elements roughly evenly over the ranks: rank r owns
+ *        [displs[r], displs[r] + counts[r]).
+ */
+inline void vector_sum_mpi_layout(std::size_t n, int size, std::vector<int>& counts, std::vector<int>& displs)
+{
+    std::size_t rem = n % size; // remainder to distribute
+    counts.resize(size);
+    displs.resize(size);
+    for (int r = 0; r < size; ++r) {
+        counts[r] = (n / size) + (r < (int)rem ? 1 : 0); // each rank gets base + 1 if it is in the first rem ranks
+        displs[r] = r * (n / size) + std::min(r, (int)rem); // displacement for each rank
+    }
+}
+
+/**
+ * @brief Distributed DAXPY on raw buffers: each rank computes its chunk of
+ *        d = a*x + y, then root gathers the full d[0..n).
+ *
+ * Every rank passes the full x and y of length n; d is only written on root
+ * (other ranks may pass nullptr). Root computes its chunk directly in d, so only
+ * the other ranks use a temporary buffer.
+ */
+inline void vector_sum_mpi(double a, const double* x, const double* y, double* d, std::size_t n)
+{
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    std::vector<int> counts, displs; // counts and displacements for gather
+    vector_sum_mpi_layout(n, size, counts, displs);
+    const std::size_t start = displs[rank];
+    const std::size_t count = counts[rank];
+
+    if (rank == 0) {
+        for (std::size_t i = 0; i < count; ++i) {
+            d[start + i] = a * x[start + i] + y[start + i];
+        }
+        MPI_Gatherv(MPI_IN_PLACE, 0, MPI_DOUBLE,
+                    d, counts.data(), displs.data(), MPI_DOUBLE,
+                    0, MPI_COMM_WORLD);
+    } else {
+        // local piece
+        std::vector<double> local_d(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            local_d[i] = a * x[start + i] + y[start + i];
+        }
+        MPI_Gatherv(local_d.data(), count, MPI_DOUBLE,
+                    nullptr, nullptr, nullptr, MPI_DOUBLE,
+                    0, MPI_COMM_WORLD);
+    }
+}
+
 /**
  * @brief Distributed DAXPY: each rank computes a chunk of d = a*x + y,
  *        then root gathers the full vector.
  *
- * @throws std::invalid_argument on size mismatch (only on rank 0).
+ * @throws std::invalid_argument on size mismatch (only on rank 0).
  */
 inline void vector_sum_mpi(double a,
                            const std::vector<double>& x,
                            const std::vector<double>& y,
                            std::vector<double>& d)
 {
-    int rank, size;
+    int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-    MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-    std::size_t n = x.size();
     if (x.size() != y.size()) {
         if (rank == 0) throw std::invalid_argument("Vectors x and y must have the same size.");
         else MPI_Abort(MPI_COMM_WORLD, 1);
     }
 
-    // split n roughly evenly
-    std::size_t base = n / size; // base number of elements per rank
-    std::size_t rem  = n % size; // remainder to distribute
-    std::size_t start = rank * base + std::min<std::size_t>(rank, rem); // start index for this rank
-    std::size_t count = base + (static_cast<std::size_t>(rank) < rem ? 1 : 0); // number of elements for this rank
+    if (rank == 0) d.resize(x.size());
+    vector_sum_mpi(a, x.data(), y.data(), rank == 0 ? d.data() : nullptr, x.size());
+}
+
+/**
+ * @brief Distributed in‑place update y = a*x + y on raw buffers.
+ *
+ * Each rank updates its own chunk of y in place and sends it straight from y;
+ * root receives the other chunks into y. Afterwards root holds the full result,
+ * while the other ranks' y is only updated in their own chunk.
+ */
+inline void vector_sum_mpi_inplace(double a, const double* x, double* y, std::size_t n)
+{
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
 
+    std::vector<int> counts, displs;
+    vector_sum_mpi_layout(n, size, counts, displs);
+    const std::size_t start = displs[rank];
+    const std::size_t count = counts[rank];
 
-    // local piece
-    std::vector<double> local_d(count);
-    for (std::size_t i = 0; i < count; ++i) {
-        local_d[i] = a * x[start + i] + y[start + i];
+    for (std::size_t i = start; i < start + count; ++i) {
+        y[i] = a * x[i] + y[i];
     }
 
-    // prepare for gather
-    std::vector<int> counts(size), displs(size); // counts and displacements for gather
-    for (int r = 0; r < size; ++r) {
-        counts[r] = (n / size) + (r < (int)rem ? 1 : 0); // each rank gets base + 1 if it is in the first rem ranks
-        displs[r] = r * (n / size) + std::min(r, (int)rem); // displacement for each rank
+    if (rank == 0) {
+        MPI_Gatherv(MPI_IN_PLACE, 0, MPI_DOUBLE,
+                    y, counts.data(), displs.data(), MPI_DOUBLE,
+                    0, MPI_COMM_WORLD);
+    } else {
+        MPI_Gatherv(y + start, count, MPI_DOUBLE,
+                    nullptr, nullptr, nullptr, MPI_DOUBLE,
+                    0, MPI_COMM_WORLD);
     }
+}
 
-    if (rank == 0) d.resize(n);
-    MPI_Gatherv(local_d.data(), count, MPI_DOUBLE,
-                d.data(), counts.data(), displs.data(), MPI_DOUBLE,
-                0, MPI_COMM_WORLD);
+/**
+ * @brief Distributed in‑place update y = a*x + y (full result on root).
+ *
+ * @throws std::invalid_argument on size mismatch (only on rank 0).
+ */
+inline void vector_sum_mpi_inplace(double a, const std::vector<double>& x, std::vector<double>& y)
+{
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if (x.size() != y.size()) {
+        if (rank == 0) throw std::invalid_argument("Vectors x and y must have the same size.");
+        else MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+    vector_sum_mpi_inplace(a, x.data(), y.data(), x.size());
 }
 
 #endif // VECTOR_SUM_MPI_HPP
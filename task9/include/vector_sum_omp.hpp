@@ -5,27 +5,81 @@
 #include <stdexcept>
 #include <cstddef>
 #include <omp.h>
+#include "aligned_buffer.hpp"
+#include "vector_sum_stream.hpp"
+
+/**
+ * @brief Parallel DAXPY on raw buffers: d[i] = a*x[i] + y[i] for i < n.
+ *
+ * d may be the same buffer as y (in‑place update y += a*x); other overlaps
+ * are not supported.  The static schedule gives each thread the same index
+ * range on every call, so pages first written here stay local to the thread
+ * that uses them.
+ *
+ * Out‑of‑place calls with n ≥ vector_sum_stream_threshold() give each thread
+ * the same contiguous range (split as schedule(static) does) and write it
+ * with streaming stores; every thread fences its own stores.
+ */
+inline void vector_sum_omp(double a, const double* x, const double* y, double* d, std::size_t n)
+{
+    if (d != y && n >= vector_sum_stream_threshold()) {
+        #pragma omp parallel
+        {
+            const std::size_t nt = std::size_t(omp_get_num_threads());
+            const std::size_t t  = std::size_t(omp_get_thread_num());
+            const std::size_t q  = n / nt, r = n % nt;
+            const std::size_t begin = t * q + (t < r ? t : r);
+            const std::size_t count = q + (t < r ? 1 : 0);
+            vector_sum_stream(a, x + begin, y + begin, d + begin, count);
+        }
+        return;
+    }
+    #pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < n; ++i) {
+        d[i] = a * x[i] + y[i];
+    }
+}
 
 /**
  * @brief Parallel DAXPY: d[i] = a*x[i] + y[i] using OpenMP.
  *
+ * Pass an aligned_vector<double> as d to skip the serial zero‑fill of resize():
+ * the first write to each page then happens in the parallel loop (first touch),
+ * on the NUMA node of the thread that computes it.
+ *
  * @throws std::invalid_argument if x.size() != y.size().
  */
+template <typename Alloc>
 inline void vector_sum_omp(double a,
                            const std::vector<double>& x,
                            const std::vector<double>& y,
-                           std::vector<double>& d)
+                           std::vector<double, Alloc>& d)
 {
     if (x.size() != y.size()) {
         throw std::invalid_argument("Vectors x and y must have the same size.");
     }
     std::size_t n = x.size();
     d.resize(n);
+    vector_sum_omp(a, x.data(), y.data(), d.data(), n);
+}
 
-    #pragma omp parallel for
-    for (std::size_t i = 0; i < n; ++i) {
-        d[i] = a * x[i] + y[i];
+/**
+ * @brief Parallel in‑place update y = a*x + y.
+ *
+ * @throws std::invalid_argument if x.size() != y.size().
+ */
+inline void vector_sum_omp_inplace(double a, const std::vector<double>& x, std::vector<double>& y)
+{
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Vectors x and y must have the same size.");
     }
+    vector_sum_omp(a, x.data(), y.data(), y.data(), x.size());
+}
+
+/// Parallel in‑place update y[i] += a*x[i] for i < n on raw buffers.
+inline void vector_sum_omp_inplace(double a, const double* x, double* y, std::size_t n)
+{
+    vector_sum_omp(a, x, y, y, n);
 }
 
 #endif // VECTOR_SUM_OMP_HPP
@@ -40,6 +40,11 @@ int main(int argc, char** argv) {
 
             assert(d_ser == d_mpi);
 
+            // in-place update: root ends up with the full result in y
+            std::vector<double> y_inplace(y);
+            vector_sum_mpi_inplace(a, x, y_inplace);
+            assert(y_inplace == d_ser);
+
             auto dt_ser = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
             auto dt_mpi = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
 
@@ -49,6 +54,8 @@ int main(int argc, char** argv) {
         } else {
             // non‐root just calls the MPI version
             vector_sum_mpi(a, x, y, d_mpi);
+            std::vector<double> y_inplace(y);
+            vector_sum_mpi_inplace(a, x, y_inplace);
         }
     }
 
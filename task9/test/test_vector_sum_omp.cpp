@@ -2,6 +2,7 @@
 #include <vector>
 #include <chrono>
 #include <cassert>
+#include <algorithm>
 
 #include "vector_sum.hpp"
 #include "vector_sum_omp.hpp"
@@ -10,6 +11,29 @@ int main() {
     std::vector<std::size_t> sizes = {1000000, 2000000, 5000000};
     double a = 2.5;
 
+    // streaming dispatch: vector_sum_omp above a forced threshold, odd per-thread ranges
+    {
+        const std::size_t n = 1001;
+        std::vector<double> x(n), y(n), d_ser(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = i * 0.5;
+            y[i] = 2.0 - i;
+        }
+        for (std::size_t i = 0; i < n; ++i) d_ser[i] = a * x[i] + y[i];
+
+        const std::size_t saved = vector_sum_stream_threshold();
+        const int saved_threads = omp_get_max_threads();
+        set_vector_sum_stream_threshold(64);
+        for (int threads = 1; threads <= 3; ++threads) {
+            omp_set_num_threads(threads);
+            aligned_vector<double> buf(n + 1);
+            vector_sum_omp(a, x.data(), y.data(), buf.data() + 1, n);
+            assert(std::equal(buf.begin() + 1, buf.end(), d_ser.begin()));
+        }
+        set_vector_sum_stream_threshold(saved);
+        omp_set_num_threads(saved_threads);
+    }
+
     for (auto n : sizes) {
         std::vector<double> x(n), y(n), d_ser, d_omp;
         for (std::size_t i = 0; i < n; ++i) {
@@ -17,20 +41,33 @@ int main() {
             y[i] = n - i * 0.001;
         }
 
+        aligned_vector<double> d_first_touch;
+
         auto t0 = std::chrono::high_resolution_clock::now();
         vector_sum(a, x, y, d_ser);
         auto t1 = std::chrono::high_resolution_clock::now();
         vector_sum_omp(a, x, y, d_omp);
         auto t2 = std::chrono::high_resolution_clock::now();
+        // aligned output: no serial zero-fill, pages are first touched in the parallel loop
+        vector_sum_omp(a, x, y, d_first_touch);
+        auto t3 = std::chrono::high_resolution_clock::now();
 
         assert(d_ser == d_omp);
+        assert(std::equal(d_first_touch.begin(), d_first_touch.end(), d_ser.begin()));
+
+        // in-place update y = a*x + y gives the same vector
+        std::vector<double> y_inplace(y);
+        vector_sum_omp_inplace(a, x, y_inplace);
+        assert(y_inplace == d_ser);
 
         auto dt_ser = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
         auto dt_omp = std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
+        auto dt_ft  = std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count();
 
         std::cout << "n=" << n 
                   << " serial=" << dt_ser << "ms"
-                  << "  omp="    << dt_omp << "ms\n";
+                  << "  omp="    << dt_omp << "ms"
+                  << "  omp (aligned, first touch)=" << dt_ft << "ms\n";
     }
     return 0;
 }